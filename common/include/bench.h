@@ -0,0 +1,42 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+#include "replay.h"
+#include "tonc_types.h"
+
+/*
+ * Benchmark runner. Each scenario puts the player at a fixed pose and
+ * replays a fixed input stream, so every run renders the same frames.
+ * Frames are run back to back without waiting for VBlank and timed with
+ * the profiler's cycle counter (prof_init() must have been called).
+ *
+ * Per scenario it reports the min/avg/max cycles per frame, the frame
+ * rate they allow, and a checksum of every displayed frame that only
+ * changes when the rendered pixels do. In mode 0 it covers the tiles,
+ * maps and OAM instead of pixels.
+ *
+ * On the GBA the results are printed with tte when the last scenario
+ * ends. The host build writes them as JSON to the file named by
+ * GBA_HOST_BENCH, or stdout, and exits.
+ */
+
+typedef struct BenchScenario {
+    const char *name;
+    // Player pose at the first frame, in the example's own units
+    s32 x;
+    s32 y;
+    u32 theta;
+    const ReplayStep *steps;
+    u32 stepCount;
+} BenchScenario;
+
+// Run every scenario. setPose moves the player to a scenario's start and
+// frame runs one frame of the example, ending with vid_flip() or, before
+// frame_init(), frame_submit()
+void bench_run(const char *title,
+    const BenchScenario *scenarios,
+    u32 count,
+    void (*setPose)(const BenchScenario *scenario),
+    void (*frame)(void));
+
+#endif
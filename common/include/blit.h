@@ -0,0 +1,25 @@
+#ifndef BLIT_H
+#define BLIT_H
+
+#include "tonc_types.h"
+
+/*
+ * Mode 4 blitters, drawing into vid_page. VRAM takes no byte writes, so
+ * m4_plot() costs a halfword read-modify-write per pixel. These write
+ * whole words or halfwords wherever they can, and only read back the
+ * halfword at an odd edge that is shared with a pixel they leave alone.
+ *
+ * Nothing is clipped, everything drawn must be on the screen.
+ */
+
+// Solid 8x8 tile at (x, y), x a multiple of 4. Two word stores per row
+void blit_tile(int x, int y, u8 clrid);
+
+// Row of width pixels from (x, y), any x and width
+void blit_span(int x, int y, int width, u8 clrid);
+
+// width x height sprite from src, 8bpp row by row, at (x, y). Palette
+// index 0 is transparent. src can be in ROM
+void blit_masked(int x, int y, const u8 *src, int width, int height);
+
+#endif
@@ -0,0 +1,66 @@
+#ifndef FRAME_H
+#define FRAME_H
+
+#include "tonc_types.h"
+
+/*
+ * Interrupt driven frame pacing for the page flipped bitmap modes. A
+ * frame is drawn into vid_page and handed over with frame_submit(). The
+ * VBlank interrupt flips to it at the first VBlank it is due, so the flip
+ * never lands mid-screen, and a frame that runs a little late is shown at
+ * the next VBlank instead of waiting out another whole frame:
+ *
+ *     frame_init(1);
+ *     while (1) {
+ *         ...simulate, and anything else that leaves vid_page alone
+ *         frame_wait();
+ *         ...draw into vid_page
+ *         frame_submit();
+ *     }
+ *
+ * frame_wait() halts the CPU until the submitted frame has been flipped
+ * in and its old page is free, rather than polling REG_VCOUNT. Work up to
+ * it overlaps the wait for the previous frame's flip.
+ *
+ * Until frame_init() is called, frame_submit() flips at once and
+ * frame_wait() returns at once, which is how bench_run() drives frames
+ * back to back.
+ *
+ * Display state that has to change with the picture, like OAM for text
+ * drawn over it, is handed to frame_on_flip(). It runs right after each
+ * flip, inside VBlank.
+ *
+ * Only modes 4 and 5 have pages. In the others a submitted frame is
+ * paced the same way, but nothing is flipped: the hook alone shows it,
+ * at the VBlank a bitmap frame would have been flipped in.
+ */
+
+typedef struct FrameStats {
+    // VBlanks since frame_init()
+    u32 vblanks;
+    // Frames flipped in
+    u32 shown;
+    // Frames flipped in at a later VBlank than the one they were due at
+    u32 late;
+    // VBlanks a frame was due at but none was ready, so the last one stayed
+    u32 dropped;
+} FrameStats;
+
+// Counted by the VBlank interrupt from the first frame shown on
+extern volatile FrameStats frameStats;
+
+// Install the VBlank interrupt and show a frame every vblanksPerFrame
+// VBlanks, 1 for 60 Hz, 2 for 30 Hz
+void frame_init(u32 vblanksPerFrame);
+
+// Halt until no submitted frame is waiting to be flipped in
+void frame_wait(void);
+
+// Queue vid_page to be flipped in at the next VBlank it is due
+void frame_submit(void);
+
+// Call onFlip right after every flip, NULL for none. It runs in the VBlank
+// interrupt once frame_init() has been called
+void frame_on_flip(fnptr onFlip);
+
+#endif
@@ -0,0 +1,56 @@
+#ifndef HUD_H
+#define HUD_H
+
+#include "tonc_types.h"
+
+/*
+ * Debug overlay of labelled integers on the OBJ layer. A slot's label is
+ * printed once with tte into both bitmap pages, and its value is a row
+ * of 8x8 objects, one per character, showing digit glyphs kept in OBJ
+ * VRAM. Setting a value that did not change costs one compare. A new
+ * value is formatted with hud_itoa() and only rewrites the slot's
+ * entries in a shadow copy of OAM, so nothing has to be redrawn after a
+ * page flip.
+ *
+ * hud_commit() copies the shadow to OAM. Hand it to frame_on_flip() and
+ * set the values between frame_wait() and frame_submit(), then they show
+ * up in VBlank together with the page they describe, never mid-screen.
+ *
+ * The display must have DCNT_OBJ | DCNT_OBJ_1D set. The glyphs take OBJ
+ * tiles from HUD_TILE_FIRST on, the upper half that bitmap modes leave to
+ * objects, and the values take OAM entries from HUD_OAM_FIRST on.
+ */
+
+enum HudConsts {
+    HUD_MAX_SLOTS = 12,
+    // Characters of the longest s32, sign included
+    HUD_MAX_CHARS = 11,
+    HUD_OAM_FIRST = 0,
+    HUD_OAM_COUNT = 96,
+    HUD_TILE_FIRST = 512,
+    HUD_PALBANK = 15,
+    // Width of a tte sys8 glyph, labels are this wide per character
+    HUD_GLYPH_WIDTH = 8,
+};
+
+// Load the glyphs in color ink and hide every HUD object
+void hud_init(COLOR ink);
+
+// Print label at (x, y) on both pages and reserve width characters after it
+// for the value, fewer if the screen ends first. Returns the slot, numbered
+// in the order they are added, or -1 when the slots or the OAM entries ran
+// out
+int hud_add(int x, int y, const char *label, u32 width);
+
+// Show value in slot from the next hud_commit(). A value with more
+// characters than the slot shows as all 9s, with its sign if negative
+void hud_set(u32 slot, s32 value);
+
+// Copy the values set since the last call to OAM. Call it in VBlank
+void hud_commit(void);
+
+// Decimal text of value in buf, which holds HUD_MAX_CHARS + 1. Returns the
+// length, without the terminating 0
+u32 hud_itoa(s32 value, char *buf);
+
+#endif
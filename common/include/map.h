@@ -0,0 +1,67 @@
+#ifndef MAP_H
+#define MAP_H
+
+#include "tonc_types.h"
+
+/*
+ * Tile map shared by the examples. The tile IDs are a byte per cell, row
+ * by row, and can stay in ROM. Tile 0 is empty floor and every other ID
+ * is solid. Beside them sits a solid mask with one bit per cell, bit
+ * x%32 of word x/32, each row starting on a new word. Collision and ray
+ * casting read the mask, a row word at a time where they can.
+ *
+ * Every accessor is bounds-safe. Cells outside the map are solid, with
+ * tile ID 0, so a ray that leaves the map stops there without hitting a
+ * wall.
+ */
+
+enum MapLimitConsts {
+    MAP_MAX_SIZE = 256,
+    MAP_WORD_BITS = 32,
+};
+
+// Mask words per row, and in total, for a width x height map
+#define MAP_PITCH(width) (((width) + MAP_WORD_BITS - 1)/MAP_WORD_BITS)
+#define MAP_SOLID_WORDS(width, height) (MAP_PITCH(width)*(height))
+
+typedef struct Map {
+    u16 width;
+    u16 height;
+    // Mask words per row
+    u16 pitch;
+    const u8 *tiles;
+    const u32 *solid;
+} Map;
+
+// Set map up over width*height tiles and fill solid,
+// MAP_SOLID_WORDS(width, height) words, from them. A map over MAP_MAX_SIZE
+// on a side is refused: it is left empty, every cell solid, and false is
+// returned
+bool map_init(Map *map, u32 width, u32 height, const u8 *tiles, u32 *solid);
+
+// Bits of the cells [x, x + count) of row y, cell x in bit 0. count is
+// at most 32. Cells outside the map read as solid
+u32 map_solid_bits(const Map *map, s32 x, s32 y, u32 count);
+
+static inline bool map_in_bounds(const Map *map, s32 x, s32 y) {
+    return (u32)x < map->width && (u32)y < map->height;
+}
+
+// Mask words of row y, which must be in bounds
+static inline const u32 *map_solid_row(const Map *map, s32 y) {
+    return &map->solid[y*map->pitch];
+}
+
+static inline bool map_solid(const Map *map, s32 x, s32 y) {
+    if (!map_in_bounds(map, x, y))
+        return true;
+    return (map_solid_row(map, y)[x/MAP_WORD_BITS] >> (x%MAP_WORD_BITS)) & 1;
+}
+
+static inline u8 map_tile(const Map *map, s32 x, s32 y) {
+    if (!map_in_bounds(map, x, y))
+        return 0;
+    return map->tiles[y*map->width + x];
+}
+
+#endif
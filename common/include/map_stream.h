@@ -0,0 +1,113 @@
+#ifndef MAP_STREAM_H
+#define MAP_STREAM_H
+
+#include "map.h"
+#include "tonc_types.h"
+
+/*
+ * Maps too big to keep decoded. A ChunkedMap stays in ROM as 16x16-cell
+ * chunks, each one raw or run-length encoded, written by
+ * common/tools/mapconv.c. Decoded chunks live in a small LRU cache in
+ * EWRAM. map_stream_update() keeps the chunks around the player and
+ * ahead of the view resident once per frame.
+ *
+ * Lookups go through a table of chunk pointers, so a resident chunk costs
+ * a table read and no decoding. A chunk that is not resident is decoded
+ * on the spot. Like Map, cells outside the map are solid with tile ID 0.
+ *
+ * Chunk encoding, the first byte of a chunk's data:
+ *     MAP_CHUNK_RAW   MAP_CHUNK_CELLS tile IDs follow, row by row
+ *     MAP_CHUNK_RLE   (run - 1, tile ID) byte pairs follow, runs of up to
+ *                     256 cells in the same order
+ */
+
+enum MapChunkConsts {
+    MAP_CHUNK_SHIFT = 4,
+    MAP_CHUNK_SIZE = 1 << MAP_CHUNK_SHIFT,
+    MAP_CHUNK_MASK = MAP_CHUNK_SIZE - 1,
+    MAP_CHUNK_CELLS = MAP_CHUNK_SIZE*MAP_CHUNK_SIZE,
+    // Chunks per side of the largest map
+    MAP_MAX_CHUNKS = MAP_MAX_SIZE/MAP_CHUNK_SIZE,
+    MAP_CHUNK_RAW = 0,
+    MAP_CHUNK_RLE = 1,
+    // Decoded chunks kept in EWRAM
+    MAP_CACHE_SLOTS = 16,
+    // Chunks map_stream_update() may decode ahead of the view per call
+    MAP_PREFETCH_PER_UPDATE = 2,
+};
+
+typedef struct ChunkedMap {
+    // Size in cells
+    u16 width;
+    u16 height;
+    // Size in chunks, rounded up
+    u16 chunksX;
+    u16 chunksY;
+    // Offset of each chunk in data, row by row
+    const u32 *offsets;
+    const u8 *data;
+} ChunkedMap;
+
+typedef struct MapChunk {
+    // Solid bit per cell, bit x of halfword y
+    u16 solid[MAP_CHUNK_SIZE];
+    u8 tiles[MAP_CHUNK_CELLS];
+} MapChunk;
+
+typedef struct MapStream {
+    const ChunkedMap *map;
+    // Resident chunk at chunk (cx, cy), index cy*MAP_MAX_CHUNKS + cx, or NULL
+    MapChunk *chunks[MAP_MAX_CHUNKS*MAP_MAX_CHUNKS];
+} MapStream;
+
+extern MapStream mapStream;
+
+// Stream map, dropping every chunk of the previous one
+void map_stream_open(const ChunkedMap *map);
+
+// Decode chunk (cx, cy) into the cache, evicting the least recently used
+// one if it is full. The chunk must be in bounds
+MapChunk *map_stream_load(s32 cx, s32 cy);
+
+// Keep the chunks around cell (x, y) resident and prefetch the ones in
+// front of the view at angle theta, in tonc units. Call once per frame
+void map_stream_update(s32 x, s32 y, u32 theta);
+
+// Bits of the cells [x, x + count) of row y, cell x in bit 0. count is
+// at most 32. Cells outside the map read as solid
+u32 map_stream_solid_bits(s32 x, s32 y, u32 count);
+
+static inline bool map_stream_in_bounds(s32 x, s32 y) {
+    return (u32)x < mapStream.map->width && (u32)y < mapStream.map->height;
+}
+
+// Chunk holding cell (x, y), which must be in bounds
+static inline const MapChunk *map_stream_chunk(s32 x, s32 y) {
+    s32 cx = x >> MAP_CHUNK_SHIFT;
+    s32 cy = y >> MAP_CHUNK_SHIFT;
+    MapChunk *chunk = mapStream.chunks[cy*MAP_MAX_CHUNKS + cx];
+    return chunk ? chunk : map_stream_load(cx, cy);
+}
+
+static inline bool map_chunk_solid(const MapChunk *chunk, s32 x, s32 y) {
+    return (chunk->solid[y & MAP_CHUNK_MASK] >> (x & MAP_CHUNK_MASK)) & 1;
+}
+
+static inline u8 map_chunk_tile(const MapChunk *chunk, s32 x, s32 y) {
+    return chunk->tiles[(y & MAP_CHUNK_MASK)*MAP_CHUNK_SIZE
+        + (x & MAP_CHUNK_MASK)];
+}
+
+static inline bool map_stream_solid(s32 x, s32 y) {
+    if (!map_stream_in_bounds(x, y))
+        return true;
+    return map_chunk_solid(map_stream_chunk(x, y), x, y);
+}
+
+static inline u8 map_stream_tile(s32 x, s32 y) {
+    if (!map_stream_in_bounds(x, y))
+        return 0;
+    return map_chunk_tile(map_stream_chunk(x, y), x, y);
+}
+
+#endif
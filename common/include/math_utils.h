@@ -0,0 +1,286 @@
+#ifndef MATH_UTILS_H
+#define MATH_UTILS_H
+
+#include "tonc_types.h"
+
+/*
+ * Fixed-point math shared by all the examples. Everything is inline
+ * here, except the reciprocal table in math_utils.c.
+ *
+ * Every format comes as a typed set of functions, q8_*, q12_* and q16_*,
+ * with the number of fraction bits in the name. The fixed_* functions
+ * below them use the format picked with FIXED_Q, 12 unless it is defined
+ * before this header is included.
+ */
+
+enum MathLimitConsts {
+    MATH_S32_MAX = 0x7FFFFFFF,
+    MATH_S32_MIN = -MATH_S32_MAX - 1,
+};
+
+/*
+ * Reciprocal table for the *_div_lut functions. Entry i is 2^30/f for the
+ * normalised divisor f = 1 + i/256, rounded to nearest, and the divisor's
+ * next 23 bits interpolate between two entries. The interpolated
+ * reciprocal is within 2^-18 (3.8e-6) of the exact one either way, so a
+ * quotient q is within 1 + q/2^18 LSB of the exact divide: 1 LSB for
+ * anything under 8.0 in q16, 5 LSB at 1024.0 in q12.
+ * It is defined once, in math_utils.c.
+ */
+enum MathRecipConsts {
+    MATH_RECIP_BITS = 8,
+    MATH_RECIP_SIZE = 1 << MATH_RECIP_BITS,
+    // Divisor bits below the table index, used to interpolate
+    MATH_RECIP_FRAC_BITS = 31 - MATH_RECIP_BITS,
+    // Entries are 2^MATH_RECIP_SHIFT / f
+    MATH_RECIP_SHIFT = 30,
+};
+
+// One entry past the end so the last interval can be interpolated
+extern const u32 mathRecipLut[MATH_RECIP_SIZE + 1];
+
+/*
+ * (num << shift) / den without a division, within the table's error of
+ * the exact quotient rounded down. den is shifted up until its top bit is
+ * set, its reciprocal is read from the table, and the quotient is one long
+ * multiply and a shift. shift must be at most 30 and den must not be 0.
+ * The exact quotient must stay below 2^32 - 2^15, or the error can carry
+ * it past the top of u32.
+ */
+static inline u32 math_udiv_lut(u32 num, u32 den, u32 shift) {
+    u32 norm = __builtin_clz(den);
+    u32 mantissa = den << norm;
+    u32 index = (mantissa >> MATH_RECIP_FRAC_BITS) & (MATH_RECIP_SIZE - 1);
+    u32 frac = mantissa & ((1u << MATH_RECIP_FRAC_BITS) - 1);
+    u32 recip = mathRecipLut[index]
+        - (u32)(((u64)(mathRecipLut[index] - mathRecipLut[index + 1]) * frac)
+            >> MATH_RECIP_FRAC_BITS);
+    // num * 2^shift / den = num * recip * 2^(shift + norm - 61)
+    return (u32)(((u64)num * recip)
+        >> (MATH_RECIP_SHIFT + 31 - shift - norm));
+}
+
+/*
+ * n/10 for any u32 without a division: a long multiply by 2^35/10,
+ * rounded up, and a shift. The rounding error stays below one for all
+ * 32-bit n, so the quotient is exact.
+ */
+static inline u32 math_div10(u32 n) {
+    return (u32)(((u64)n * 0xCCCCCCCDu) >> 35);
+}
+
+// Integer square root, rounded down
+static inline u32 math_isqrt64(u64 x) {
+    u64 root = 0;
+    u64 bit = (u64)1 << 62;
+    while (bit > x) {
+        bit >>= 2;
+    }
+    while (bit) {
+        if (x >= root + bit) {
+            x -= root + bit;
+            root = (root >> 1) + bit;
+        }
+        else {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    return (u32)root;
+}
+
+/*
+ * Angle of the vector (x, y) in tonc's units, 0x10000 per turn, the same
+ * as the BIOS ArcTan2 and lu_sin. Arguments are in that order too. The
+ * first octant uses the polynomial
+ *     atan(t) = pi/4 t + t (1 - t) (0.2447 + 0.0663 t)
+ * and the others mirror it. The result is within 18 units (0.0018 radians).
+ */
+static inline u16 math_atan2(s32 x, s32 y) {
+    u32 absX = x < 0 ? -x : x;
+    u32 absY = y < 0 ? -y : y;
+    if (!absX && !absY)
+        return 0;
+    bool steep = absY > absX;
+    u32 lo = steep ? absX : absY;
+    u32 hi = steep ? absY : absX;
+    // t = lo/hi in .15 fixed point
+    s32 t = math_udiv_lut(lo, hi, 15);
+    s32 curve = 2552 + ((692 * t) >> 15);
+    s32 angle = ((0x2000 * t) >> 15)
+        + ((((t * ((1 << 15) - t)) >> 15) * curve) >> 15);
+    if (steep) angle = 0x4000 - angle;
+    if (x < 0) angle = 0x8000 - angle;
+    if (y < 0) angle = -angle;
+    return (u16)angle;
+}
+
+/*
+ * Functions of a format with shift fraction bits:
+ * q_from_int   integer to fixed point
+ * q_to_int     nearest integer, halves rounded away from zero
+ * q_floor      largest integer not above x
+ * q_mul        product, wraps around on overflow
+ * q_mul_sat    product, clamped to the s32 range on overflow
+ * q_div        exact quotient rounded towards zero, a 64-bit software
+ *              division. Slow, keep it out of per-frame loops
+ * q_div_lut    quotient from the reciprocal table, no division
+ * q_recip      1/x from the reciprocal table, rounded to nearest
+ * q_div_fast   a * q_recip(b). Cheaper than q_div_lut when the same
+ *              divisor is reused, but only as precise as the reciprocal
+ * q_abs        absolute value
+ * q_sqrt       square root, rounded down. 0 for x <= 0
+ * q_atan2      math_atan2 on fixed point coordinates
+ */
+#define MATH_DEFINE_Q(q, shift) \
+typedef s32 q; \
+\
+static inline q q##_from_int(s32 x) { \
+    return x << (shift); \
+} \
+\
+static inline s32 q##_to_int(q x) { \
+    /* Rounded on the magnitude, adding the half bit rather than half so */ \
+    /* nothing overflows at the ends of the range */ \
+    u32 magnitude = x < 0 ? 0u - (u32)x : (u32)x; \
+    s32 rounded = (magnitude >> (shift)) + ((magnitude >> ((shift) - 1)) & 1); \
+    return x < 0 ? -rounded : rounded; \
+} \
+\
+static inline s32 q##_floor(q x) { \
+    return x >> (shift); \
+} \
+\
+static inline q q##_mul(q a, q b) { \
+    return (q)(((s64)a * b) >> (shift)); \
+} \
+\
+static inline q q##_mul_sat(q a, q b) { \
+    s64 product = ((s64)a * b) >> (shift); \
+    if (product > MATH_S32_MAX) return MATH_S32_MAX; \
+    if (product < MATH_S32_MIN) return MATH_S32_MIN; \
+    return (q)product; \
+} \
+\
+static inline q q##_div(q a, q b) { \
+    return (q)(((s64)a << (shift)) / b); \
+} \
+\
+static inline q q##_div_lut(q a, q b) { \
+    u32 quotient = math_udiv_lut(a < 0 ? -a : a, b < 0 ? -b : b, (shift)); \
+    return (a ^ b) < 0 ? -(q)quotient : (q)quotient; \
+} \
+\
+static inline q q##_recip(q x) { \
+    u32 recip = (math_udiv_lut(2 << (shift), x < 0 ? -x : x, (shift)) + 1) >> 1; \
+    return x < 0 ? -(q)recip : (q)recip; \
+} \
+\
+static inline q q##_div_fast(q a, q b) { \
+    return q##_mul(a, q##_recip(b)); \
+} \
+\
+static inline u32 q##_abs(q x) { \
+    return x < 0 ? -x : x; \
+} \
+\
+static inline q q##_sqrt(q x) { \
+    return x > 0 ? (q)math_isqrt64((u64)x << (shift)) : 0; \
+} \
+\
+static inline u16 q##_atan2(q x, q y) { \
+    return math_atan2(x, y); \
+}
+
+MATH_DEFINE_Q(q8, 8)
+MATH_DEFINE_Q(q12, 12)
+MATH_DEFINE_Q(q16, 16)
+
+
+// Default format
+#ifndef FIXED_Q
+#define FIXED_Q 12
+#endif
+
+#if FIXED_Q != 8 && FIXED_Q != 12 && FIXED_Q != 16
+#error "FIXED_Q must be 8, 12 or 16"
+#endif
+
+enum FixedShiftConsts {
+    FIXED_SHIFT = FIXED_Q,
+    FIXED_ONE = 1 << FIXED_SHIFT,
+    FIXED_HALF = 1 << (FIXED_SHIFT - 1),
+};
+
+// Convert to Fixed point for macros
+#define INT_TO_FIXED(x) ((int)((x) << FIXED_SHIFT))
+// Convert a constant with a fraction, such as 0.6, to fixed point
+#define FIXED_CONST(x) ((int)((x) * (1 << FIXED_SHIFT)))
+
+// fixed_name is q<FIXED_Q>_name
+#define MATH_FIXED_FN(name) MATH_FIXED_FN_(FIXED_Q, name)
+#define MATH_FIXED_FN_(n, name) MATH_FIXED_FN__(n, name)
+#define MATH_FIXED_FN__(n, name) q##n##_##name
+
+// Convert to Fixed point
+static inline s32 int_to_fixed(s32 x) {
+    return MATH_FIXED_FN(from_int)(x);
+}
+
+// Convert to the nearest integer
+static inline s32 fixed_to_int_s(s32 x) {
+    return MATH_FIXED_FN(to_int)(x);
+}
+
+// It adds half the divisor to round up
+static inline u32 fixed_to_int_u(u32 x) {
+    return (x + FIXED_HALF) >> FIXED_SHIFT;
+}
+
+#define fixed_to_int(x) _Generic((x), \
+s32: fixed_to_int_s,    \
+u32: fixed_to_int_u,   \
+default: fixed_to_int_s \
+)(x)
+
+static inline s32 fixed_floor(s32 x) {
+    return MATH_FIXED_FN(floor)(x);
+}
+
+static inline s32 fixed_mul(s32 a, s32 b) {
+    return MATH_FIXED_FN(mul)(a, b);
+}
+
+static inline s32 fixed_mul_sat(s32 a, s32 b) {
+    return MATH_FIXED_FN(mul_sat)(a, b);
+}
+
+static inline s32 fixed_div(s32 a, s32 b) {
+    return MATH_FIXED_FN(div)(a, b);
+}
+
+static inline s32 fixed_div_lut(s32 a, s32 b) {
+    return MATH_FIXED_FN(div_lut)(a, b);
+}
+
+static inline s32 fixed_recip(s32 x) {
+    return MATH_FIXED_FN(recip)(x);
+}
+
+static inline s32 fixed_div_fast(s32 a, s32 b) {
+    return MATH_FIXED_FN(div_fast)(a, b);
+}
+
+static inline u32 fixed_abs(s32 x) {
+    return MATH_FIXED_FN(abs)(x);
+}
+
+static inline s32 fixed_sqrt(s32 x) {
+    return MATH_FIXED_FN(sqrt)(x);
+}
+
+static inline u16 fixed_atan2(s32 x, s32 y) {
+    return MATH_FIXED_FN(atan2)(x, y);
+}
+
+#endif
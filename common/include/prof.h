@@ -0,0 +1,69 @@
+#ifndef PROF_H
+#define PROF_H
+
+#include "tonc_types.h"
+
+/*
+ * Frame profiler. Named stages are timed with the cascaded TM2/TM3 pair
+ * running at the full system clock, so one count is one CPU cycle:
+ *
+ *     PROF_BEGIN("cast");
+ *     ...
+ *     PROF_END;
+ *
+ * Stages may nest. Time spent in a stage adds up over the frame, and
+ * prof_frame() files each total into a rolling window of PROF_WINDOW
+ * frames, from which the min/avg/max are taken. The "frame" stage is
+ * recorded by prof_frame() itself, from one call to the next.
+ *
+ * prof_init() takes over TM2 and TM3, so tonc's profile_start() and
+ * profile_stop() must not be used alongside it. Build with PROF set to 0
+ * to compile the scopes out.
+ */
+#ifndef PROF
+#define PROF 1
+#endif
+
+enum ProfConsts {
+    PROF_MAX_STAGES = 12,
+    // Deepest nesting of PROF_BEGIN scopes
+    PROF_MAX_DEPTH = 4,
+    // Frames the min/avg/max are taken over
+    PROF_WINDOW = 32,
+};
+
+typedef struct ProfStats {
+    const char *name;
+    u32 min;
+    u32 avg;
+    u32 max;
+} ProfStats;
+
+// Start the timers. Call once before the first scope
+void prof_init(void);
+
+// Cycles counted by the profiler timers, wraps around every 256 seconds
+u32 prof_now(void);
+
+void prof_begin(const char *name);
+void prof_end(void);
+
+// Close the current frame. Call once per frame
+void prof_frame(void);
+
+// Stages in the order they were first entered
+u32 prof_stage_count(void);
+ProfStats prof_stats(u32 stage);
+
+// Print every stage's min/avg/max in cycles from the top left of the screen
+void prof_draw(void);
+
+#if PROF
+#define PROF_BEGIN(name) prof_begin(name)
+#define PROF_END prof_end()
+#else
+#define PROF_BEGIN(name) ((void)0)
+#define PROF_END ((void)0)
+#endif
+
+#endif
@@ -0,0 +1,44 @@
+#ifndef REPLAY_H
+#define REPLAY_H
+
+#include "tonc_types.h"
+
+/*
+ * Recorded input. A stream is a list of steps, each holding the same keys
+ * and frame time for a number of frames, so a run can be played back
+ * frame for frame without a keypad or a real clock.
+ *
+ * Games read input through replay_key_poll() instead of key_poll(), and
+ * pass the dt they measure through replay_dt(). Both are pass-throughs
+ * until replay_start() is called.
+ *
+ * The host build records live runs when GBA_HOST_RECORD names a file. The
+ * steps are written there on exit as a C initializer that can be pasted
+ * into a ReplayStep array.
+ */
+
+typedef struct ReplayStep {
+    // Frames the step lasts
+    u16 frames;
+    // KEY_* bits held down
+    u16 keys;
+    // Frame time in TM0 ticks at /64, as calc_delta_time() measures it
+    u16 dt;
+} ReplayStep;
+
+// Play steps back from the next replay_next() on
+void replay_start(const ReplayStep *steps, u32 count);
+
+// Go back to the keypad and the measured dt
+void replay_stop(void);
+
+// Advance to the next frame of the replay. false once every step played
+bool replay_next(void);
+
+// key_poll(), with the replayed keys while a replay plays
+void replay_key_poll(void);
+
+// The replayed frame time while a replay plays, otherwise measured
+u16 replay_dt(u16 measured);
+
+#endif
@@ -0,0 +1,43 @@
+#ifndef TICK_H
+#define TICK_H
+
+#include "tonc_types.h"
+
+/*
+ * Fixed timestep scheduler. The simulation advances in ticks of TICK_DT,
+ * however long the frames that draw it take:
+ *
+ *     u32 ticks = tick_advance(dt);
+ *     while (ticks--) {
+ *         ...simulate one TICK_DT
+ *     }
+ *     ...draw, blending the last two ticks by tick_alpha()
+ *
+ * Frame time is banked and spent a tick at a time. What is left over is
+ * how far the frame is into the next tick, so drawing the state between
+ * the last two ticks at tick_alpha() stays smooth when frames and ticks
+ * don't line up. After a long stall at most TICK_MAX_CATCH_UP ticks are
+ * run and the rest of the time is dropped, so a slow frame slows the game
+ * down for a moment instead of making every next frame slower still.
+ */
+
+enum TickConsts {
+    // TM0 ticks at /64 per second
+    TICK_CLOCK = 262144,
+    TICK_HZ = 60,
+    // Length of a tick, in TM0 ticks at /64 like the dt games measure
+    TICK_DT = TICK_CLOCK/TICK_HZ,
+    // Most ticks run for one frame
+    TICK_MAX_CATCH_UP = 4,
+};
+
+// Start from an empty bank, the next tick_advance() runs no stale time
+void tick_reset(void);
+
+// Bank dt, in TM0 ticks at /64, and return how many ticks to run now
+u32 tick_advance(u16 dt);
+
+// How far the bank is into the next tick, [0, FIXED_ONE) in fixed point
+s32 tick_alpha(void);
+
+#endif
@@ -0,0 +1,164 @@
+#include "bench.h"
+#include "prof.h"
+#include "tonc_oam.h"
+#include "tonc_memdef.h"
+#include "tonc_memmap.h"
+#include "tonc_tte.h"
+#include "tonc_video.h"
+
+#ifdef GBA_HOST
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#endif
+
+enum BenchConsts {
+    BENCH_MAX_SCENARIOS = 8,
+    // System clock, cycles per second
+    BENCH_CLOCK = 16777216,
+    // FNV-1a
+    BENCH_HASH_SEED = 0x811C9DC5,
+    BENCH_HASH_PRIME = 0x01000193,
+    // Pixels between result lines
+    BENCH_LINE_HEIGHT = 10,
+};
+
+typedef struct BenchResult {
+    const char *name;
+    u32 frames;
+    u32 minCycles;
+    u32 avgCycles;
+    u32 maxCycles;
+    // Frames per second the average allows, .2 fixed point decimal
+    u32 fps100;
+    u32 checksum;
+} BenchResult;
+
+static BenchResult results[BENCH_MAX_SCENARIOS];
+
+// Fold the displayed picture into hash
+static u32 screen_checksum(u32 hash) {
+    const u32 *words;
+    u32 count;
+    switch (REG_DISPCNT & DCNT_MODE_MASK) {
+    case DCNT_MODE3:
+        words = (const u32*)vid_mem;
+        count = M3_WIDTH*M3_HEIGHT*2/4;
+        break;
+    case DCNT_MODE4:
+        words = (const u32*)((REG_DISPCNT & DCNT_PAGE)
+            ? vid_mem_back : vid_mem_front);
+        count = M4_WIDTH*M4_HEIGHT/4;
+        break;
+    case DCNT_MODE0:
+        // Tiles and maps of the backgrounds, then the objects. Not the
+        // composited picture, but it changes whenever that does
+        words = (const u32*)tile_mem;
+        count = 0x10000/4;
+        for (u32 i = 0; i < OAM_SIZE/4; i++) {
+            hash = (hash ^ ((const u32*)oam_mem)[i]) * BENCH_HASH_PRIME;
+        }
+        break;
+    default:
+        return hash;
+    }
+    for (u32 i = 0; i < count; i++) {
+        hash = (hash ^ words[i]) * BENCH_HASH_PRIME;
+    }
+    return hash;
+}
+
+static BenchResult run_scenario(const BenchScenario *scenario,
+    void (*setPose)(const BenchScenario *scenario),
+    void (*frame)(void))
+{
+    BenchResult result = { scenario->name, 0, 0xFFFFFFFF, 0, 0, 0,
+        BENCH_HASH_SEED };
+    u64 total = 0;
+    setPose(scenario);
+    replay_start(scenario->steps, scenario->stepCount);
+    while (replay_next()) {
+        u32 start = prof_now();
+        frame();
+        u32 cycles = prof_now() - start;
+        total += cycles;
+        if (cycles < result.minCycles) result.minCycles = cycles;
+        if (cycles > result.maxCycles) result.maxCycles = cycles;
+        result.frames++;
+        result.checksum = screen_checksum(result.checksum);
+    }
+    replay_stop();
+    if (result.frames) {
+        result.avgCycles = total / result.frames;
+    }
+    if (result.avgCycles) {
+        result.fps100 = (u64)BENCH_CLOCK * 100 / result.avgCycles;
+    }
+    return result;
+}
+
+#ifdef GBA_HOST
+static void write_results(const char *title, u32 count) {
+    const char *path = getenv("GBA_HOST_BENCH");
+    FILE *f = path && strcmp(path, "-") ? fopen(path, "w") : stdout;
+    if (!f) {
+        perror(path);
+        exit(1);
+    }
+    fprintf(f, "{\n  \"example\": \"%s\",\n", title);
+    fprintf(f, "  \"clock\": \"host\",\n  \"scenarios\": [\n");
+    for (u32 i = 0; i < count; i++) {
+        const BenchResult *r = &results[i];
+        fprintf(f, "    {\"name\": \"%s\", \"frames\": %u, "
+            "\"cycles_min\": %u, \"cycles_avg\": %u, \"cycles_max\": %u, "
+            "\"fps\": %u.%02u, \"checksum\": \"%08x\"}%s\n",
+            r->name, (unsigned)r->frames, (unsigned)r->minCycles,
+            (unsigned)r->avgCycles, (unsigned)r->maxCycles,
+            (unsigned)(r->fps100 / 100), (unsigned)(r->fps100 % 100),
+            (unsigned)r->checksum, i + 1 < count ? "," : "");
+    }
+    fprintf(f, "  ]\n}\n");
+    if (f != stdout) {
+        fclose(f);
+    }
+}
+#endif
+
+// Show the results and stop
+static void report(const char *title, u32 count) {
+#ifdef GBA_HOST
+    write_results(title, count);
+    exit(0);
+#else
+    tte_write("#{P:0,0}");
+    tte_erase_line();
+    tte_printf("%s", title);
+    for (u32 i = 0; i < count; i++) {
+        const BenchResult *r = &results[i];
+        tte_printf("#{P:0,%d}", (i + 1) * BENCH_LINE_HEIGHT);
+        tte_erase_line();
+        tte_printf("%-8s%7u %3u.%02u %08X", r->name, (uint)r->avgCycles,
+            (uint)(r->fps100 / 100), (uint)(r->fps100 % 100),
+            (uint)r->checksum);
+    }
+    vid_flip();
+    while (1) {
+        vid_vsync();
+    }
+#endif
+}
+
+void bench_run(const char *title,
+    const BenchScenario *scenarios,
+    u32 count,
+    void (*setPose)(const BenchScenario *scenario),
+    void (*frame)(void))
+{
+    if (count > BENCH_MAX_SCENARIOS) {
+        count = BENCH_MAX_SCENARIOS;
+    }
+    for (u32 i = 0; i < count; i++) {
+        results[i] = run_scenario(&scenarios[i], setPose, frame);
+    }
+    report(title, count);
+}
@@ -0,0 +1,77 @@
+#include "blit.h"
+#include "tonc_video.h"
+
+enum BlitConsts {
+    BLIT_TILE_SIZE = 8,
+    // Halfwords and words per mode 4 row
+    BLIT_PITCH16 = M4_WIDTH/2,
+    BLIT_PITCH32 = M4_WIDTH/4,
+};
+
+void blit_tile(int x, int y, u8 clrid) {
+    u32 *dst = (u32*)vid_page + (y*M4_WIDTH + x)/4;
+    u32 fill = clrid*0x01010101;
+    for (u32 row = 0; row < BLIT_TILE_SIZE; row++, dst += BLIT_PITCH32) {
+        dst[0] = fill;
+        dst[1] = fill;
+    }
+}
+
+void blit_span(int x, int y, int width, u8 clrid) {
+    if (width <= 0)
+        return;
+    u16 *dst = &vid_page[(y*M4_WIDTH + x)/2];
+    u32 fill = clrid*0x01010101;
+    // A lone pixel in the high byte of the first halfword
+    if (x & 1) {
+        *dst = (*dst & 0x00FF) | clrid << 8;
+        dst++;
+        x++;
+        width--;
+    }
+    // Up to a word boundary, then words. Rows are whole words, so that is
+    // down to x alone
+    if (width >= 2 && (x & 2)) {
+        *dst++ = fill;
+        width -= 2;
+    }
+    u32 *dst32 = (u32*)dst;
+    for (; width >= 4; width -= 4) {
+        *dst32++ = fill;
+    }
+    dst = (u16*)dst32;
+    if (width >= 2) {
+        *dst++ = fill;
+        width -= 2;
+    }
+    // And one in the low byte of the last halfword
+    if (width)
+        *dst = (*dst & 0xFF00) | clrid;
+}
+
+void blit_masked(int x, int y, const u8 *src, int width, int height) {
+    u16 *row = &vid_page[(y*M4_WIDTH + x)/2];
+    for (int j = 0; j < height; j++, row += BLIT_PITCH16, src += width) {
+        u16 *dst = row;
+        int i = 0;
+        if (x & 1) {
+            if (src[0])
+                *dst = (*dst & 0x00FF) | src[0] << 8;
+            dst++;
+            i = 1;
+        }
+        // Pixel pairs, stored without a read unless one of them is clear
+        for (; i + 1 < width; i += 2, dst++) {
+            u32 lo = src[i];
+            u32 hi = src[i + 1];
+            if (lo && hi)
+                *dst = lo | hi << 8;
+            else if (lo)
+                *dst = (*dst & 0xFF00) | lo;
+            else if (hi)
+                *dst = (*dst & 0x00FF) | hi << 8;
+        }
+        if (i < width && src[i])
+            *dst = (*dst & 0xFF00) | src[i];
+    }
+}
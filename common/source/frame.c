@@ -0,0 +1,74 @@
+#include "frame.h"
+#include "tonc_bios.h"
+#include "tonc_irq.h"
+#include "tonc_memdef.h"
+#include "tonc_memmap.h"
+#include "tonc_video.h"
+
+volatile FrameStats frameStats;
+
+static u32 frameVblanks;
+// VBlanks since the last flip
+static volatile u32 sinceFlip;
+static volatile bool pending;
+static bool started;
+static fnptr flipHook;
+
+// The page, then whatever has to change with it
+static void flip(void) {
+    u32 mode = REG_DISPCNT & DCNT_MODE_MASK;
+    if (mode == DCNT_MODE4 || mode == DCNT_MODE5)
+        vid_flip();
+    if (flipHook)
+        flipHook();
+}
+
+static void frame_vblank(void) {
+    frameStats.vblanks++;
+    if (++sinceFlip < frameVblanks)
+        return;
+    if (!pending) {
+        if (frameStats.shown)
+            frameStats.dropped++;
+        return;
+    }
+    flip();
+    pending = false;
+    if (frameStats.shown && sinceFlip > frameVblanks)
+        frameStats.late++;
+    frameStats.shown++;
+    sinceFlip = 0;
+}
+
+void frame_init(u32 vblanksPerFrame) {
+    frameVblanks = vblanksPerFrame ? vblanksPerFrame : 1;
+    sinceFlip = 0;
+    pending = false;
+    frameStats.vblanks = 0;
+    frameStats.shown = 0;
+    frameStats.late = 0;
+    frameStats.dropped = 0;
+    irq_init(NULL);
+    irq_add(II_VBLANK, frame_vblank);
+    started = true;
+}
+
+void frame_wait(void) {
+    // IntrWait() without clearing returns at once for a VBlank that came
+    // between the check and the call, so none is slept through
+    while (pending) {
+        IntrWait(0, IRQ_VBLANK);
+    }
+}
+
+void frame_submit(void) {
+    if (!started) {
+        flip();
+        return;
+    }
+    pending = true;
+}
+
+void frame_on_flip(fnptr onFlip) {
+    flipHook = onFlip;
+}
@@ -0,0 +1,162 @@
+#include "hud.h"
+#include "math_utils.h"
+#include "tonc_memdef.h"
+#include "tonc_memmap.h"
+#include "tonc_oam.h"
+#include "tonc_tte.h"
+#include "tonc_video.h"
+#include <string.h>
+
+enum HudGlyphConsts {
+    // '0' to '9', then '-'
+    HUD_GLYPH_MINUS = 10,
+    HUD_GLYPH_COUNT = 11,
+    HUD_INK_IDX = 1,
+};
+
+typedef struct HudSlot {
+    s32 value;
+    bool valid;
+    u16 x;
+    u16 y;
+    u8 width;
+    // OAM entry of the first character
+    u8 firstObj;
+} HudSlot;
+
+// One row per byte, leftmost pixel in the top bit
+static const u8 glyphRows[HUD_GLYPH_COUNT][8] = {
+    {0x3C, 0x66, 0x6E, 0x76, 0x66, 0x66, 0x3C, 0x00},
+    {0x18, 0x38, 0x18, 0x18, 0x18, 0x18, 0x7E, 0x00},
+    {0x3C, 0x66, 0x06, 0x0C, 0x30, 0x60, 0x7E, 0x00},
+    {0x3C, 0x66, 0x06, 0x1C, 0x06, 0x66, 0x3C, 0x00},
+    {0x0C, 0x1C, 0x3C, 0x6C, 0x7E, 0x0C, 0x0C, 0x00},
+    {0x7E, 0x60, 0x7C, 0x06, 0x06, 0x66, 0x3C, 0x00},
+    {0x1C, 0x30, 0x60, 0x7C, 0x66, 0x66, 0x3C, 0x00},
+    {0x7E, 0x06, 0x0C, 0x18, 0x30, 0x30, 0x30, 0x00},
+    {0x3C, 0x66, 0x66, 0x3C, 0x66, 0x66, 0x3C, 0x00},
+    {0x3C, 0x66, 0x66, 0x3E, 0x06, 0x0C, 0x38, 0x00},
+    {0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00},
+};
+
+static HudSlot slots[HUD_MAX_SLOTS];
+static u32 slotCount;
+static u32 objCount;
+// What hud_commit() copies to OAM from HUD_OAM_FIRST on
+static OBJ_ATTR shadowOam[HUD_OAM_COUNT];
+// Set when shadowOam has changed since the last commit
+static volatile bool shadowDirty;
+
+// Expand the 1bpp rows into 4bpp tiles, one nibble per pixel
+static void load_glyphs(void) {
+    TILE *tiles = (TILE*)tile_mem_obj[0] + HUD_TILE_FIRST;
+    for (u32 g = 0; g < HUD_GLYPH_COUNT; g++) {
+        for (u32 row = 0; row < 8; row++) {
+            u32 bits = glyphRows[g][row];
+            u32 nibbles = 0;
+            for (u32 x = 0; x < 8; x++) {
+                if (bits & (0x80 >> x))
+                    nibbles |= HUD_INK_IDX << (4*x);
+            }
+            tiles[g].data[row] = nibbles;
+        }
+    }
+}
+
+void hud_init(COLOR ink) {
+    load_glyphs();
+    pal_obj_mem[HUD_PALBANK*16 + HUD_INK_IDX] = ink;
+    oam_init(shadowOam, HUD_OAM_COUNT);
+    oam_init(&oam_mem[HUD_OAM_FIRST], HUD_OAM_COUNT);
+    shadowDirty = false;
+    slotCount = 0;
+    objCount = 0;
+}
+
+int hud_add(int x, int y, const char *label, u32 width) {
+    if (slotCount == HUD_MAX_SLOTS || objCount + width > HUD_OAM_COUNT)
+        return -1;
+
+    // The label never changes, so it goes into both pages once
+    TTC *tc = tte_get_context();
+    u8 *dst = tc->dst.data;
+    for (u32 page = 0; page < 2; page++) {
+        tc->dst.data = (u8*)(page ? vid_mem_back : vid_mem_front);
+        tte_set_pos(x, y);
+        tte_write(label);
+    }
+    tc->dst.data = dst;
+
+    HudSlot *slot = &slots[slotCount];
+    slot->valid = false;
+    slot->x = x + strlen(label)*HUD_GLYPH_WIDTH;
+    slot->y = y;
+    // No wider than the longest s32 or what is left of the screen
+    u32 room = slot->x < SCREEN_WIDTH
+        ? (SCREEN_WIDTH - slot->x)/HUD_GLYPH_WIDTH : 0;
+    if (width > room) width = room;
+    slot->width = width < HUD_MAX_CHARS ? width : HUD_MAX_CHARS;
+    slot->firstObj = HUD_OAM_FIRST + objCount;
+    objCount += slot->width;
+    return slotCount++;
+}
+
+void hud_set(u32 slot, s32 value) {
+    HudSlot *s = &slots[slot];
+    if (s->valid && s->value == value)
+        return;
+    s->value = value;
+    s->valid = true;
+
+    char text[HUD_MAX_CHARS + 1];
+    u32 length = hud_itoa(value, text);
+    // Too many digits for the slot: all 9s, after the sign, rather than
+    // the leading digits of a wrong number
+    if (length > s->width) {
+        length = s->width;
+        for (u32 i = value < 0 ? 1 : 0; i < length; i++) {
+            text[i] = '9';
+        }
+    }
+    OBJ_ATTR *obj = &shadowOam[s->firstObj - HUD_OAM_FIRST];
+    for (u32 i = 0; i < s->width; i++) {
+        if (i >= length) {
+            obj_hide(&obj[i]);
+            continue;
+        }
+        u32 glyph = text[i] == '-' ? HUD_GLYPH_MINUS : text[i] - '0';
+        obj_set_attr(&obj[i],
+            ATTR0_REG | ATTR0_4BPP | ATTR0_SQUARE | ATTR0_Y(s->y),
+            ATTR1_SIZE_8 | ATTR1_X(s->x + i*HUD_GLYPH_WIDTH),
+            ATTR2_PALBANK(HUD_PALBANK) | ATTR2_ID(HUD_TILE_FIRST + glyph));
+    }
+    shadowDirty = true;
+}
+
+void hud_commit(void) {
+    if (!shadowDirty)
+        return;
+    oam_copy(&oam_mem[HUD_OAM_FIRST], shadowOam, objCount);
+    shadowDirty = false;
+}
+
+u32 hud_itoa(s32 value, char *buf) {
+    // Digits come out last first, into the end of a scratch buffer
+    char digits[HUD_MAX_CHARS];
+    char *p = digits + HUD_MAX_CHARS;
+    u32 n = value < 0 ? -(u32)value : (u32)value;
+    do {
+        u32 q = math_div10(n);
+        *--p = '0' + (n - q*10);
+        n = q;
+    } while (n);
+    if (value < 0)
+        *--p = '-';
+
+    u32 length = digits + HUD_MAX_CHARS - p;
+    for (u32 i = 0; i < length; i++) {
+        buf[i] = p[i];
+    }
+    buf[length] = '\0';
+    return length;
+}
@@ -0,0 +1,51 @@
+#include "map.h"
+
+bool map_init(Map *map, u32 width, u32 height, const u8 *tiles, u32 *solid) {
+    // Cutting an oversize map down would read its rows at the wrong stride,
+    // so it is refused and left empty, solid everywhere
+    bool fits = width <= MAP_MAX_SIZE && height <= MAP_MAX_SIZE;
+    if (!fits)
+        width = height = 0;
+    map->width = width;
+    map->height = height;
+    map->pitch = MAP_PITCH(width);
+    map->tiles = tiles;
+    map->solid = solid;
+
+    for (u32 y = 0; y < height; y++) {
+        u32 *row = &solid[y*map->pitch];
+        for (u32 w = 0; w < map->pitch; w++) {
+            row[w] = 0;
+        }
+        for (u32 x = 0; x < width; x++) {
+            if (tiles[y*width + x])
+                row[x/MAP_WORD_BITS] |= 1u << (x%MAP_WORD_BITS);
+        }
+    }
+    return fits;
+}
+
+// Word w of row, with the cells past the right edge set
+static inline u32 padded_word(const Map *map, const u32 *row, s32 w) {
+    if (w < 0 || w >= map->pitch)
+        return ~0u;
+    u32 word = row[w];
+    u32 end = map->width - w*MAP_WORD_BITS;
+    if (end < MAP_WORD_BITS)
+        word |= ~0u << end;
+    return word;
+}
+
+u32 map_solid_bits(const Map *map, s32 x, s32 y, u32 count) {
+    u32 mask = count < MAP_WORD_BITS ? (1u << count) - 1 : ~0u;
+    if ((u32)y >= map->height)
+        return mask;
+    const u32 *row = map_solid_row(map, y);
+    // Arithmetic shift, so x < 0 lands in word -1
+    s32 w = x >> 5;
+    u32 shift = x & (MAP_WORD_BITS - 1);
+    u32 bits = padded_word(map, row, w) >> shift;
+    if (shift)
+        bits |= padded_word(map, row, w + 1) << (MAP_WORD_BITS - shift);
+    return bits & mask;
+}
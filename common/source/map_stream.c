@@ -0,0 +1,172 @@
+#include "map_stream.h"
+#include "tonc_math.h"
+
+enum MapStreamConsts {
+    // Angle either side of the view that is prefetched, in tonc units
+    MAP_PREFETCH_SPREAD = 0x2000,
+    NO_CHUNK = -1,
+};
+
+MapStream mapStream;
+
+EWRAM_BSS static MapChunk cache[MAP_CACHE_SLOTS];
+// Chunk index each slot holds, or NO_CHUNK
+static s16 slotChunk[MAP_CACHE_SLOTS];
+// Value of useClock when each slot was last needed
+static u32 lastUse[MAP_CACHE_SLOTS];
+// Counts calls to map_stream_update()
+static u32 useClock;
+
+void map_stream_open(const ChunkedMap *map) {
+    mapStream.map = map;
+    for (u32 i = 0; i < countof(mapStream.chunks); i++) {
+        mapStream.chunks[i] = NULL;
+    }
+    for (u32 i = 0; i < MAP_CACHE_SLOTS; i++) {
+        slotChunk[i] = NO_CHUNK;
+        lastUse[i] = 0;
+    }
+    useClock = 1;
+}
+
+static void decode_chunk(MapChunk *chunk, const u8 *data) {
+    const u8 *src = data + 1;
+    if (data[0] == MAP_CHUNK_RLE) {
+        u32 cell = 0;
+        while (cell < MAP_CHUNK_CELLS) {
+            u32 run = *src++ + 1;
+            u8 tile = *src++;
+            if (run > MAP_CHUNK_CELLS - cell)
+                run = MAP_CHUNK_CELLS - cell;
+            for (u32 i = 0; i < run; i++) {
+                chunk->tiles[cell++] = tile;
+            }
+        }
+    }
+    else {
+        for (u32 cell = 0; cell < MAP_CHUNK_CELLS; cell++) {
+            chunk->tiles[cell] = src[cell];
+        }
+    }
+
+    const u8 *row = chunk->tiles;
+    for (u32 y = 0; y < MAP_CHUNK_SIZE; y++, row += MAP_CHUNK_SIZE) {
+        u32 solid = 0;
+        for (u32 x = 0; x < MAP_CHUNK_SIZE; x++) {
+            if (row[x])
+                solid |= 1 << x;
+        }
+        chunk->solid[y] = solid;
+    }
+}
+
+// Free slot, or else the least recently used one
+static u32 victim_slot(void) {
+    u32 best = 0;
+    for (u32 i = 0; i < MAP_CACHE_SLOTS; i++) {
+        if (slotChunk[i] == NO_CHUNK)
+            return i;
+        if (lastUse[i] < lastUse[best])
+            best = i;
+    }
+    return best;
+}
+
+MapChunk *map_stream_load(s32 cx, s32 cy) {
+    const ChunkedMap *map = mapStream.map;
+    u32 slot = victim_slot();
+    if (slotChunk[slot] != NO_CHUNK) {
+        mapStream.chunks[slotChunk[slot]] = NULL;
+    }
+    u32 index = cy*MAP_MAX_CHUNKS + cx;
+    MapChunk *chunk = &cache[slot];
+    decode_chunk(chunk, map->data + map->offsets[cy*map->chunksX + cx]);
+    slotChunk[slot] = index;
+    lastUse[slot] = useClock;
+    mapStream.chunks[index] = chunk;
+    return chunk;
+}
+
+typedef enum TouchMode {
+    // Only mark a resident chunk as used
+    TOUCH_ONLY,
+    // Decode a missing chunk if that evicts nothing needed this frame
+    TOUCH_PREFETCH,
+    // Decode a missing chunk whatever it evicts
+    TOUCH_LOAD,
+} TouchMode;
+
+// Mark chunk (cx, cy) as used this frame. Returns whether it was decoded
+static bool touch_chunk(s32 cx, s32 cy, TouchMode mode) {
+    const ChunkedMap *map = mapStream.map;
+    if ((u32)cx >= map->chunksX || (u32)cy >= map->chunksY)
+        return false;
+    MapChunk *chunk = mapStream.chunks[cy*MAP_MAX_CHUNKS + cx];
+    if (chunk) {
+        lastUse[chunk - cache] = useClock;
+        return false;
+    }
+    if (mode == TOUCH_ONLY)
+        return false;
+    if (mode == TOUCH_PREFETCH && lastUse[victim_slot()] == useClock)
+        return false;
+    map_stream_load(cx, cy);
+    return true;
+}
+
+void map_stream_update(s32 x, s32 y, u32 theta) {
+    useClock++;
+    s32 cx = x >> MAP_CHUNK_SHIFT;
+    s32 cy = y >> MAP_CHUNK_SHIFT;
+    for (s32 i = -1; i < 2; i++) {
+        for (s32 j = -1; j < 2; j++) {
+            touch_chunk(cx + j, cy + i, TOUCH_LOAD);
+        }
+    }
+
+    // One and two chunks straight ahead, and one chunk out on either side
+    // of the view, nearest first
+    static const struct { s16 angle; u8 dist; } ahead[] = {
+        { 0, MAP_CHUNK_SIZE },
+        { -MAP_PREFETCH_SPREAD, MAP_CHUNK_SIZE },
+        { MAP_PREFETCH_SPREAD, MAP_CHUNK_SIZE },
+        { 0, 2*MAP_CHUNK_SIZE },
+    };
+    u32 budget = MAP_PREFETCH_PER_UPDATE;
+    for (u32 i = 0; i < countof(ahead); i++) {
+        u32 angle = theta + ahead[i].angle;
+        s32 px = x + ((lu_cos(angle)*ahead[i].dist) >> 12);
+        s32 py = y + ((lu_sin(angle)*ahead[i].dist) >> 12);
+        if (touch_chunk(px >> MAP_CHUNK_SHIFT, py >> MAP_CHUNK_SHIFT,
+                budget ? TOUCH_PREFETCH : TOUCH_ONLY))
+            budget--;
+    }
+}
+
+u32 map_stream_solid_bits(s32 x, s32 y, u32 count) {
+    u32 bits = 0;
+    u32 i = 0;
+    while (i < count) {
+        s32 cellX = x + i;
+        if (!map_stream_in_bounds(cellX, y)) {
+            bits |= 1u << i;
+            i++;
+            continue;
+        }
+        // The rest of this chunk's row in one go, up to the map's edge.
+        // cellX is in bounds here, so the cells left to the edge are
+        // counted in u32 without wrapping
+        const MapChunk *chunk = map_stream_chunk(cellX, y);
+        u32 offset = cellX & MAP_CHUNK_MASK;
+        u32 run = MAP_CHUNK_SIZE - offset;
+        u32 toEdge = mapStream.map->width - (u32)cellX;
+        if (run > count - i)
+            run = count - i;
+        if (run > toEdge)
+            run = toEdge;
+        bits |= ((chunk->solid[y & MAP_CHUNK_MASK] >> offset)
+            & ((1u << run) - 1)) << i;
+        i += run;
+    }
+    return bits;
+}
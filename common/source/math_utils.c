@@ -0,0 +1,18 @@
+#include "math_utils.h"
+
+// Entry i is 2^MATH_RECIP_SHIFT / (1 + i/256), rounded to nearest. Built
+// from these macros, so there is no generator to run
+#define MATH_RECIP_1(i) \
+    (u32)((((u64)1 << (MATH_RECIP_SHIFT + MATH_RECIP_BITS + 1)) \
+        / (MATH_RECIP_SIZE + (i)) + 1) / 2),
+#define MATH_RECIP_4(i) MATH_RECIP_1(i) MATH_RECIP_1(i + 1) \
+    MATH_RECIP_1(i + 2) MATH_RECIP_1(i + 3)
+#define MATH_RECIP_16(i) MATH_RECIP_4(i) MATH_RECIP_4(i + 4) \
+    MATH_RECIP_4(i + 8) MATH_RECIP_4(i + 12)
+#define MATH_RECIP_64(i) MATH_RECIP_16(i) MATH_RECIP_16(i + 16) \
+    MATH_RECIP_16(i + 32) MATH_RECIP_16(i + 48)
+
+const u32 mathRecipLut[MATH_RECIP_SIZE + 1] = {
+    MATH_RECIP_64(0) MATH_RECIP_64(64) MATH_RECIP_64(128) MATH_RECIP_64(192)
+    MATH_RECIP_1(MATH_RECIP_SIZE)
+};
@@ -0,0 +1,182 @@
+#include "prof.h"
+#include "tonc_memdef.h"
+#include "tonc_memmap.h"
+#include "tonc_tte.h"
+#include <string.h>
+
+#ifdef GBA_HOST
+#include "gba_host.h"
+#include <stdio.h>
+#include <stdlib.h>
+#endif
+
+enum ProfDrawConsts {
+    // Pixels between overlay lines
+    PROF_LINE_HEIGHT = 10,
+};
+
+typedef struct ProfStage {
+    const char *name;
+    // Cycles spent in the stage so far this frame
+    u32 frameTotal;
+    // Totals of the last PROF_WINDOW frames
+    u32 samples[PROF_WINDOW];
+} ProfStage;
+
+static ProfStage stages[PROF_MAX_STAGES];
+static u32 stageCount;
+
+// Open scopes, innermost last
+static u32 openStages[PROF_MAX_DEPTH];
+static u32 openStarts[PROF_MAX_DEPTH];
+static u32 depth;
+
+// Next sample slot and the number of slots filled
+static u32 windowIndex;
+static u32 windowFrames;
+static u32 frameStart;
+
+#ifdef GBA_HOST
+// Host time, counted in GBA cycles
+static inline u32 prof_cycles(void) {
+    return host_clock_cycles();
+}
+
+static void prof_dump(void);
+#else
+// TM3 counts TM2 overflows, together a 32-bit cycle counter
+static inline u32 prof_cycles(void) {
+    u16 hi, lo;
+    do {
+        hi = REG_TM3CNT_L;
+        lo = REG_TM2CNT_L;
+    } while (hi != REG_TM3CNT_L);
+    return (hi << 16) | lo;
+}
+#endif
+
+// Index of the stage called name, added on first use
+static u32 find_stage(const char *name) {
+    // The same string literal usually has the same address
+    for (u32 i = 0; i < stageCount; i++) {
+        if (stages[i].name == name)
+            return i;
+    }
+    for (u32 i = 0; i < stageCount; i++) {
+        if (!strcmp(stages[i].name, name))
+            return i;
+    }
+    if (stageCount == PROF_MAX_STAGES)
+        return PROF_MAX_STAGES;
+    stages[stageCount].name = name;
+    return stageCount++;
+}
+
+void prof_init(void) {
+    REG_TM2CNT_H = 0;
+    REG_TM3CNT_H = 0;
+    REG_TM2CNT_L = 0;
+    REG_TM3CNT_L = 0;
+    REG_TM3CNT_H = TM_ENABLE | TM_CASCADE;
+    REG_TM2CNT_H = TM_ENABLE;
+    find_stage("frame");
+    frameStart = prof_cycles();
+#ifdef GBA_HOST
+    atexit(prof_dump);
+#endif
+}
+
+u32 prof_now(void) {
+    return prof_cycles();
+}
+
+void prof_begin(const char *name) {
+    if (depth < PROF_MAX_DEPTH) {
+        openStages[depth] = find_stage(name);
+        openStarts[depth] = prof_cycles();
+    }
+    depth++;
+}
+
+void prof_end(void) {
+    u32 now = prof_cycles();
+    if (!depth)
+        return;
+    depth--;
+    if (depth < PROF_MAX_DEPTH && openStages[depth] < PROF_MAX_STAGES) {
+        stages[openStages[depth]].frameTotal += now - openStarts[depth];
+    }
+}
+
+void prof_frame(void) {
+    u32 now = prof_cycles();
+    stages[0].frameTotal = now - frameStart;
+    frameStart = now;
+    for (u32 i = 0; i < stageCount; i++) {
+        stages[i].samples[windowIndex] = stages[i].frameTotal;
+        stages[i].frameTotal = 0;
+    }
+    windowIndex = (windowIndex + 1) % PROF_WINDOW;
+    if (windowFrames < PROF_WINDOW) {
+        windowFrames++;
+    }
+}
+
+u32 prof_stage_count(void) {
+    return stageCount;
+}
+
+ProfStats prof_stats(u32 stage) {
+    const ProfStage *s = &stages[stage];
+    ProfStats stats = { s->name, 0, 0, 0 };
+    if (!windowFrames)
+        return stats;
+    u32 sum = 0;
+    stats.min = 0xFFFFFFFF;
+    for (u32 i = 0; i < windowFrames; i++) {
+        u32 sample = s->samples[i];
+        sum += sample;
+        if (sample < stats.min) stats.min = sample;
+        if (sample > stats.max) stats.max = sample;
+    }
+    stats.avg = sum / windowFrames;
+    return stats;
+}
+
+void prof_draw(void) {
+    tte_write("#{P:0,0}");
+    tte_erase_line();
+    tte_printf("%-9s %7s %7s %7s", "cycles", "min", "avg", "max");
+    for (u32 i = 0; i < stageCount; i++) {
+        ProfStats stats = prof_stats(i);
+        tte_printf("#{P:0,%d}", (i + 1) * PROF_LINE_HEIGHT);
+        tte_erase_line();
+        tte_printf("%-9s %7u %7u %7u", stats.name,
+            (uint)stats.min, (uint)stats.avg, (uint)stats.max);
+    }
+}
+
+#ifdef GBA_HOST
+// Write the stats to the file named by GBA_HOST_PROF when the run ends
+static void prof_dump(void) {
+    const char *path = getenv("GBA_HOST_PROF");
+    if (!path)
+        return;
+    FILE *f = strcmp(path, "-") ? fopen(path, "w") : stdout;
+    if (!f) {
+        perror(path);
+        return;
+    }
+    fprintf(f, "# host time in GBA cycles over the last %u frames\n",
+        (unsigned)windowFrames);
+    fprintf(f, "%-12s %10s %10s %10s\n", "stage", "min", "avg", "max");
+    for (u32 i = 0; i < stageCount; i++) {
+        ProfStats stats = prof_stats(i);
+        fprintf(f, "%-12s %10u %10u %10u\n", stats.name,
+            (unsigned)stats.min, (unsigned)stats.avg, (unsigned)stats.max);
+    }
+    if (f != stdout) {
+        fclose(f);
+    }
+}
+#endif
@@ -0,0 +1,119 @@
+#include "replay.h"
+#include "tonc_input.h"
+
+#ifdef GBA_HOST
+#include <stdio.h>
+#include <stdlib.h>
+#endif
+
+static const ReplayStep *steps;
+static u32 stepCount;
+// Step being played and the frames left in it
+static u32 stepIndex;
+static u32 framesLeft;
+static bool playing;
+
+void replay_start(const ReplayStep *replaySteps, u32 count) {
+    steps = replaySteps;
+    stepCount = count;
+    stepIndex = 0;
+    framesLeft = 0;
+    playing = true;
+    // Start from released keys, so nothing counts as held from before
+    __key_curr = 0;
+    __key_prev = 0;
+}
+
+void replay_stop(void) {
+    playing = false;
+}
+
+bool replay_next(void) {
+    if (!playing)
+        return false;
+    if (framesLeft) {
+        framesLeft--;
+    }
+    while (!framesLeft) {
+        if (stepIndex == stepCount) {
+            playing = false;
+            return false;
+        }
+        framesLeft = steps[stepIndex++].frames;
+    }
+    return true;
+}
+
+#ifdef GBA_HOST
+enum ReplayRecordConsts {
+    REPLAY_MAX_RECORDED = 4096,
+};
+
+static ReplayStep recorded[REPLAY_MAX_RECORDED];
+static u32 recordedCount;
+static u16 recordedDt;
+static const char *recordPath;
+
+// Write the recorded steps as a C initializer
+static void write_recording(void) {
+    FILE *f = fopen(recordPath, "w");
+    if (!f) {
+        perror(recordPath);
+        return;
+    }
+    for (u32 i = 0; i < recordedCount; i++) {
+        fprintf(f, "    { %u, 0x%03X, %u },\n", (unsigned)recorded[i].frames,
+            (unsigned)recorded[i].keys, (unsigned)recorded[i].dt);
+    }
+    fclose(f);
+}
+
+static void record_frame(u16 keys) {
+    static bool started;
+    if (!started) {
+        started = true;
+        recordPath = getenv("GBA_HOST_RECORD");
+        if (recordPath) {
+            atexit(write_recording);
+        }
+    }
+    if (!recordPath)
+        return;
+    ReplayStep *last = recordedCount ? &recorded[recordedCount - 1] : NULL;
+    if (last && last->keys == keys && last->dt == recordedDt
+            && last->frames < 0xFFFF) {
+        last->frames++;
+    }
+    else if (recordedCount < REPLAY_MAX_RECORDED) {
+        recorded[recordedCount++] = (ReplayStep){ 1, keys, recordedDt };
+    }
+}
+#endif
+
+// Step of the current frame, NULL before the first replay_next()
+static inline const ReplayStep *current_step(void) {
+    return playing && stepIndex ? &steps[stepIndex - 1] : NULL;
+}
+
+void replay_key_poll(void) {
+    const ReplayStep *step = current_step();
+    if (step) {
+        __key_prev = __key_curr;
+        __key_curr = step->keys & KEY_MASK;
+        return;
+    }
+    key_poll();
+#ifdef GBA_HOST
+    record_frame(key_curr_state());
+#endif
+}
+
+u16 replay_dt(u16 measured) {
+    const ReplayStep *step = current_step();
+    if (step)
+        return step->dt;
+#ifdef GBA_HOST
+    recordedDt = measured;
+#endif
+    return measured;
+}
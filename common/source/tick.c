@@ -0,0 +1,26 @@
+#include "tick.h"
+#include "math_utils.h"
+
+// Frame time not simulated yet, in TM0 ticks at /64
+static u32 banked;
+
+void tick_reset(void) {
+    banked = 0;
+}
+
+u32 tick_advance(u16 dt) {
+    banked += dt;
+    u32 ticks = banked/TICK_DT;
+    if (ticks > TICK_MAX_CATCH_UP) {
+        ticks = TICK_MAX_CATCH_UP;
+        banked = 0;
+    }
+    else {
+        banked -= ticks*TICK_DT;
+    }
+    return ticks;
+}
+
+s32 tick_alpha(void) {
+    return int_to_fixed(banked)/TICK_DT;
+}
@@ -0,0 +1,215 @@
+/*
+ * Converts a level into a ChunkedMap (see common/include/map_stream.h).
+ * This is a host tool, build and run it with:
+ *     cc -o mapconv common/tools/mapconv.c
+ *     ./mapconv worldMap maps/world.txt > source/world_map.c
+ *
+ * Levels are text or PGM images:
+ *   .txt   one line per row of cells. '.', ' ' and '0' are empty floor,
+ *          '1' to '9' are tile IDs 1 to 9 and 'A' to 'Z' are 10 to 35.
+ *          Lines starting with ';' are comments. Short rows are padded
+ *          with floor.
+ *   .pgm   binary (P5) or plain (P2) greymap, one pixel per cell. The
+ *          grey level is the tile ID.
+ *
+ * Each 16x16 chunk is written run-length encoded when that is smaller
+ * than raw. Cells of edge chunks that fall outside the map are floor.
+ */
+#include <ctype.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+enum ConverterConsts {
+    MAX_SIZE = 256,
+    CHUNK_SHIFT = 4,
+    CHUNK_SIZE = 1 << CHUNK_SHIFT,
+    CHUNK_CELLS = CHUNK_SIZE*CHUNK_SIZE,
+    CHUNK_RAW = 0,
+    CHUNK_RLE = 1,
+    MAX_RUN = 256,
+    MAX_LINE = 1024,
+};
+
+typedef struct Level {
+    int width;
+    int height;
+    uint8_t cells[MAX_SIZE][MAX_SIZE];
+} Level;
+
+static Level level;
+
+static void fail(const char *message, const char *path) {
+    fprintf(stderr, "mapconv: %s: %s\n", path, message);
+    exit(1);
+}
+
+static int text_tile(int c) {
+    if (c == '.' || c == ' ' || c == '0')
+        return 0;
+    if (c >= '1' && c <= '9')
+        return c - '0';
+    if (c >= 'A' && c <= 'Z')
+        return c - 'A' + 10;
+    return -1;
+}
+
+static void read_text(FILE *f, const char *path) {
+    char line[MAX_LINE];
+    while (fgets(line, sizeof(line), f)) {
+        if (line[0] == ';')
+            continue;
+        int length = strcspn(line, "\r\n");
+        if (level.height == MAX_SIZE || length > MAX_SIZE)
+            fail("level larger than 256x256", path);
+        for (int x = 0; x < length; x++) {
+            int tile = text_tile(line[x]);
+            if (tile < 0)
+                fail("unknown cell character", path);
+            level.cells[level.height][x] = tile;
+        }
+        if (length > level.width)
+            level.width = length;
+        level.height++;
+    }
+}
+
+// Next number in a PGM header, skipping whitespace and comments
+static int pgm_number(FILE *f, const char *path) {
+    int c = fgetc(f);
+    while (c == '#' || isspace(c)) {
+        if (c == '#') {
+            while (c != '\n' && c != EOF) {
+                c = fgetc(f);
+            }
+        }
+        c = fgetc(f);
+    }
+    if (!isdigit(c))
+        fail("bad PGM header", path);
+    int n = 0;
+    while (isdigit(c)) {
+        n = n*10 + c - '0';
+        c = fgetc(f);
+    }
+    return n;
+}
+
+static void read_pgm(FILE *f, const char *path) {
+    char magic[2];
+    if (fread(magic, 1, 2, f) != 2 || magic[0] != 'P'
+            || (magic[1] != '5' && magic[1] != '2'))
+        fail("not a P5 or P2 PGM", path);
+    level.width = pgm_number(f, path);
+    level.height = pgm_number(f, path);
+    int maxval = pgm_number(f, path);
+    if (level.width > MAX_SIZE || level.height > MAX_SIZE)
+        fail("level larger than 256x256", path);
+    if (maxval > 255)
+        fail("16-bit PGMs are not supported", path);
+    for (int y = 0; y < level.height; y++) {
+        for (int x = 0; x < level.width; x++) {
+            int value = magic[1] == '5' ? fgetc(f) : pgm_number(f, path);
+            if (value == EOF)
+                fail("truncated PGM", path);
+            level.cells[y][x] = value;
+        }
+    }
+}
+
+// Encode one chunk, encoding byte first. Returns its size in bytes
+static int encode_chunk(int cx, int cy, uint8_t *out) {
+    uint8_t cells[CHUNK_CELLS];
+    for (int y = 0; y < CHUNK_SIZE; y++) {
+        for (int x = 0; x < CHUNK_SIZE; x++) {
+            cells[y*CHUNK_SIZE + x] =
+                level.cells[cy*CHUNK_SIZE + y][cx*CHUNK_SIZE + x];
+        }
+    }
+
+    uint8_t rle[2*CHUNK_CELLS];
+    int rleSize = 0;
+    for (int i = 0; i < CHUNK_CELLS;) {
+        int run = 1;
+        while (i + run < CHUNK_CELLS && run < MAX_RUN
+                && cells[i + run] == cells[i]) {
+            run++;
+        }
+        rle[rleSize++] = run - 1;
+        rle[rleSize++] = cells[i];
+        i += run;
+    }
+
+    if (rleSize < CHUNK_CELLS) {
+        out[0] = CHUNK_RLE;
+        memcpy(out + 1, rle, rleSize);
+        return 1 + rleSize;
+    }
+    out[0] = CHUNK_RAW;
+    memcpy(out + 1, cells, CHUNK_CELLS);
+    return 1 + CHUNK_CELLS;
+}
+
+int main(int argc, char **argv) {
+    if (argc != 3) {
+        fprintf(stderr, "usage: mapconv <name> <level.txt|level.pgm>\n");
+        return 1;
+    }
+    const char *name = argv[1];
+    const char *path = argv[2];
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        perror(path);
+        return 1;
+    }
+    const char *ext = strrchr(path, '.');
+    if (ext && !strcmp(ext, ".pgm")) {
+        read_pgm(f, path);
+    } else {
+        read_text(f, path);
+    }
+    fclose(f);
+    if (!level.width || !level.height)
+        fail("empty level", path);
+
+    int chunksX = (level.width + CHUNK_SIZE - 1) >> CHUNK_SHIFT;
+    int chunksY = (level.height + CHUNK_SIZE - 1) >> CHUNK_SHIFT;
+    static uint8_t data[MAX_SIZE*MAX_SIZE/CHUNK_CELLS][1 + CHUNK_CELLS];
+    static int sizes[MAX_SIZE*MAX_SIZE/CHUNK_CELLS];
+    for (int cy = 0; cy < chunksY; cy++) {
+        for (int cx = 0; cx < chunksX; cx++) {
+            int i = cy*chunksX + cx;
+            sizes[i] = encode_chunk(cx, cy, data[i]);
+        }
+    }
+
+    printf("// Generated by common/tools/mapconv.c from %s, do not edit\n",
+        path);
+    printf("#include \"map_stream.h\"\n\n");
+    printf("static const u32 %sOffsets[%d] = {\n", name, chunksX*chunksY);
+    int offset = 0;
+    for (int i = 0; i < chunksX*chunksY; i++) {
+        printf("%s%d,%s", i % 8 ? " " : "    ", offset,
+            i % 8 == 7 || i == chunksX*chunksY - 1 ? "\n" : "");
+        offset += sizes[i];
+    }
+    printf("};\n\n");
+
+    printf("static const u8 %sData[%d] = {\n", name, offset);
+    for (int i = 0; i < chunksX*chunksY; i++) {
+        printf("    // Chunk (%d, %d), %s\n", i % chunksX, i / chunksX,
+            data[i][0] == CHUNK_RLE ? "RLE" : "raw");
+        for (int b = 0; b < sizes[i]; b++) {
+            printf("%s0x%02X,%s", b % 12 ? " " : "    ", data[i][b],
+                b % 12 == 11 || b == sizes[i] - 1 ? "\n" : "");
+        }
+    }
+    printf("};\n\n");
+
+    printf("const ChunkedMap %s = {\n", name);
+    printf("    %d, %d, %d, %d, %sOffsets, %sData\n", level.width, level.height,
+        chunksX, chunksY, name, name);
+    printf("};\n");
+    return 0;
+}
@@ -0,0 +1,19 @@
+/*
+ * Services of the host shim that have no libtonc counterpart. Code that
+ * uses them is built with GBA_HOST defined.
+ */
+
+#ifndef GBA_HOST_H
+#define GBA_HOST_H
+
+#include "tonc_types.h"
+
+enum GbaHostConsts {
+    // GBA system clock, cycles per second
+    GBA_HOST_CLOCK = 16777216,
+};
+
+// Host time in GBA cycles, for profiling. Wraps around like a 32-bit timer
+u32 host_clock_cycles(void);
+
+#endif
@@ -0,0 +1,20 @@
+/*
+ * Host shim for libtonc: umbrella header.
+ */
+
+#ifndef TONC_MAIN
+#define TONC_MAIN
+
+#include "tonc_types.h"
+#include "tonc_memmap.h"
+#include "tonc_memdef.h"
+#include "tonc_core.h"
+#include "tonc_bios.h"
+#include "tonc_irq.h"
+#include "tonc_math.h"
+#include "tonc_oam.h"
+#include "tonc_input.h"
+#include "tonc_video.h"
+#include "tonc_tte.h"
+
+#endif
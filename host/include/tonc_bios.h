@@ -0,0 +1,29 @@
+/*
+ * Host shim for libtonc: BIOS calls.
+ */
+
+#ifndef TONC_BIOS
+#define TONC_BIOS
+
+#include "tonc_types.h"
+
+#define CS_CPY     0
+#define CS_FILL    (1<<24)
+#define CS_CPY16   0
+#define CS_CPY32   (1<<26)
+#define CS_FILL32  (5<<24)
+
+#define CFS_CPY    CS_CPY
+#define CFS_FILL   CS_FILL
+
+void Halt(void);
+void IntrWait(u32 flagClear, u32 irq);
+void VBlankIntrWait(void);
+s32 Div(s32 num, s32 den);
+s32 DivMod(s32 num, s32 den);
+u32 Sqrt(u32 num);
+u16 ArcTan2(s16 x, s16 y);
+void CpuSet(const void *src, void *dst, u32 mode);
+void CpuFastSet(const void *src, void *dst, u32 mode);
+
+#endif
@@ -0,0 +1,25 @@
+/*
+ * Host shim for libtonc: core helpers (copies, fills, profiling).
+ */
+
+#ifndef TONC_CORE
+#define TONC_CORE
+
+#include "tonc_types.h"
+#include "tonc_memmap.h"
+#include "tonc_memdef.h"
+
+void memset16(void *dst, u16 hw, uint hwcount);
+void memcpy16(void *dst, const void *src, uint hwcount);
+void memset32(void *dst, u32 wd, uint wcount);
+void memcpy32(void *dst, const void *src, uint wcount);
+
+// DMA completes immediately on the host; sizes are in bytes as in tonc
+void dma3_cpy(void *dst, const void *src, uint size);
+void dma3_fill(void *dst, u32 fill, uint size);
+
+// On the host the profiling pair counts nanoseconds of host time
+void profile_start(void);
+uint profile_stop(void);
+
+#endif
@@ -0,0 +1,30 @@
+/*
+ * Host shim for libtonc: key input. REG_KEYINPUT is driven by the shim's
+ * scripted input, so key_poll() behaves exactly as on hardware.
+ */
+
+#ifndef TONC_INPUT
+#define TONC_INPUT
+
+#include "tonc_types.h"
+#include "tonc_memmap.h"
+#include "tonc_memdef.h"
+
+extern u16 __key_curr, __key_prev;
+
+INLINE void key_poll(void)
+{
+    __key_prev= __key_curr;
+    __key_curr= ~REG_KEYINPUT & KEY_MASK;
+}
+
+INLINE u32 key_curr_state(void)         {   return __key_curr;              }
+INLINE u32 key_prev_state(void)         {   return __key_prev;              }
+INLINE u32 key_is_down(u32 key)         {   return  __key_curr & key;       }
+INLINE u32 key_is_up(u32 key)           {   return ~__key_curr & key;       }
+INLINE u32 key_was_down(u32 key)        {   return  __key_prev & key;       }
+INLINE u32 key_hit(u32 key)             {   return ( __key_curr&~__key_prev) & key; }
+INLINE u32 key_released(u32 key)        {   return (~__key_curr& __key_prev) & key; }
+INLINE u32 key_held(u32 key)            {   return ( __key_curr& __key_prev) & key; }
+
+#endif
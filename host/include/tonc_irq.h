@@ -0,0 +1,27 @@
+/*
+ * Host shim for libtonc: interrupts. Only VBlank is raised, once per
+ * emulated frame.
+ */
+
+#ifndef TONC_IRQ
+#define TONC_IRQ
+
+#include "tonc_types.h"
+
+typedef enum eIrqIndex
+{
+    II_VBLANK=0, II_HBLANK, II_VCOUNT, II_TIMER0,
+    II_TIMER1,   II_TIMER2, II_TIMER3, II_SERIAL,
+    II_DMA0,     II_DMA1,   II_DMA2,   II_DMA3,
+    II_KEYPAD,   II_GAMEPAK,II_MAX
+} eIrqIndex;
+
+#define IRQ_VBLANK 0x0001
+
+void irq_init(fnptr isr);
+fnptr irq_add(enum eIrqIndex irq_id, fnptr isr);
+fnptr irq_delete(enum eIrqIndex irq_id);
+void irq_enable(enum eIrqIndex irq_id);
+void irq_disable(enum eIrqIndex irq_id);
+
+#endif
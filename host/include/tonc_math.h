@@ -0,0 +1,39 @@
+/*
+ * Host shim for libtonc: math helpers and lookup tables.
+ */
+
+#ifndef TONC_MATH
+#define TONC_MATH
+
+#include "tonc_types.h"
+
+#define SIN_LUT_SIZE 514
+#define DIV_LUT_SIZE 257
+
+// Filled at startup with the same values tonc ships (.12 sine, .16 1/x)
+extern s16 sin_lut[SIN_LUT_SIZE];
+extern u16 div_lut[DIV_LUT_SIZE];
+
+#define ABS(x)       ( (x)>=0 ? (x) : -(x) )
+#define SGN(x)       ( (x)>=0 ? 1 : -1 )
+#define MAX(a, b)    ( ((a) >= (b)) ? (a) : (b) )
+#define MIN(a, b)    ( ((a) <= (b)) ? (a) : (b) )
+#define IN_RANGE(x, min, max) ( ((x)>=(min)) && ((x)<(max)) )
+
+INLINE int sgn(int x)
+{   return (x>=0) ? +1 : -1;                                    }
+
+// Truncates x to stay in range [min, max>
+INLINE int clamp(int x, int min, int max)
+{   return (x>=max) ? (max-1) : ( (x<min) ? min : x );          }
+
+INLINE s32 lu_sin(uint theta)
+{   return sin_lut[(theta>>7)&0x1FF];                           }
+
+INLINE s32 lu_cos(uint theta)
+{   return sin_lut[((theta>>7)+128)&0x1FF];                     }
+
+INLINE uint lu_div(uint x)
+{   return div_lut[x];                                          }
+
+#endif
@@ -0,0 +1,97 @@
+/*
+ * Host shim for libtonc: register bit definitions (subset used by the demos).
+ */
+
+#ifndef TONC_MEMDEF
+#define TONC_MEMDEF
+
+#define DCNT_MODE0   0x0000
+#define DCNT_MODE1   0x0001
+#define DCNT_MODE2   0x0002
+#define DCNT_MODE3   0x0003
+#define DCNT_MODE4   0x0004
+#define DCNT_MODE5   0x0005
+#define DCNT_PAGE    0x0010
+#define DCNT_OBJ_1D  0x0040
+#define DCNT_BLANK   0x0080
+#define DCNT_BG0     0x0100
+#define DCNT_BG1     0x0200
+#define DCNT_BG2     0x0400
+#define DCNT_BG3     0x0800
+#define DCNT_OBJ     0x1000
+#define DCNT_MODE_MASK 0x0007
+
+#define DSTAT_IN_VBL   0x0001
+#define DSTAT_VBL_IRQ  0x0008
+
+#define BG_4BPP      0
+#define BG_8BPP      0x0080
+#define BG_REG_32x32 0
+#define BG_REG_64x32 0x4000
+#define BG_REG_32x64 0x8000
+#define BG_REG_64x64 0xC000
+#define BG_SIZE_MASK 0xC000
+#define BG_PRIO_MASK 0x0003
+#define BG_CBB_SHIFT 2
+#define BG_CBB(n)    ((n)<<BG_CBB_SHIFT)
+#define BG_SBB_SHIFT 8
+#define BG_SBB(n)    ((n)<<BG_SBB_SHIFT)
+#define BG_PRIO(n)   (n)
+
+#define SE_ID_MASK   0x03FF
+#define SE_HFLIP     0x0400
+#define SE_VFLIP     0x0800
+#define SE_PALBANK_SHIFT 12
+#define SE_PALBANK(n) ((n)<<SE_PALBANK_SHIFT)
+
+#define TM_FREQ_SYS  0
+#define TM_FREQ_1    0
+#define TM_FREQ_64   0x0001
+#define TM_FREQ_256  0x0002
+#define TM_FREQ_1024 0x0003
+#define TM_CASCADE   0x0004
+#define TM_IRQ       0x0040
+#define TM_ENABLE    0x0080
+
+#define KEY_A        0x0001
+#define KEY_B        0x0002
+#define KEY_SELECT   0x0004
+#define KEY_START    0x0008
+#define KEY_RIGHT    0x0010
+#define KEY_LEFT     0x0020
+#define KEY_UP       0x0040
+#define KEY_DOWN     0x0080
+#define KEY_R        0x0100
+#define KEY_L        0x0200
+#define KEY_MASK     0x03FF
+
+#define DMA_DST_INC   0
+#define DMA_SRC_FIXED 0x01000000
+#define DMA_16        0
+#define DMA_32        0x04000000
+#define DMA_ENABLE    0x80000000
+#define DMA_NOW       0
+#define DMA_CPY16     (DMA_NOW | DMA_16)
+#define DMA_CPY32     (DMA_NOW | DMA_32)
+#define DMA_FILL16    (DMA_NOW | DMA_SRC_FIXED | DMA_16)
+#define DMA_FILL32    (DMA_NOW | DMA_SRC_FIXED | DMA_32)
+
+#define WS_STANDARD  0x4317
+
+#define ATTR0_REG    0
+#define ATTR0_HIDE   0x0200
+#define ATTR0_4BPP   0
+#define ATTR0_8BPP   0x2000
+#define ATTR0_SQUARE 0
+#define ATTR0_Y_MASK 0x00FF
+#define ATTR0_Y(n)   ((n)&0xFF)
+#define ATTR1_SIZE_8 0
+#define ATTR1_SIZE_16 0x4000
+#define ATTR1_X_MASK 0x01FF
+#define ATTR1_X(n)   ((n)&0x1FF)
+#define ATTR2_ID_MASK 0x03FF
+#define ATTR2_ID(n)  ((n)&0x3FF)
+#define ATTR2_PRIO(n) (((n)&3)<<10)
+#define ATTR2_PALBANK(n) (((n)&15)<<12)
+
+#endif
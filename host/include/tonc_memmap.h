@@ -0,0 +1,91 @@
+/*
+ * Host shim for libtonc: memory map. IO, palette, VRAM and OAM are plain
+ * arrays owned by the shim, so register and VRAM accesses work unchanged.
+ */
+
+#ifndef TONC_MEMMAP
+#define TONC_MEMMAP
+
+#include "tonc_types.h"
+
+extern u32 host_io[0x400/4];
+extern u32 host_pal[0x400/4];
+extern u32 host_vram[0x18000/4];
+extern u32 host_oam[0x400/4];
+
+#define MEM_IO   ((uintptr_t)host_io)
+#define MEM_PAL  ((uintptr_t)host_pal)
+#define MEM_VRAM ((uintptr_t)host_vram)
+#define MEM_OAM  ((uintptr_t)host_oam)
+
+#define PAL_SIZE  0x00400
+#define VRAM_SIZE 0x18000
+#define OAM_SIZE  0x00400
+
+#define VRAM_PAGE_SIZE  0x0A000
+#define MEM_VRAM_FRONT  (MEM_VRAM)
+#define MEM_VRAM_BACK   (MEM_VRAM + VRAM_PAGE_SIZE)
+#define MEM_VRAM_OBJ    (MEM_VRAM + 0x10000)
+
+#define pal_bg_mem   ((COLOR*)MEM_PAL)
+#define pal_obj_mem  ((COLOR*)(MEM_PAL + 0x0200))
+
+#define tile_mem     ((CHARBLOCK*)MEM_VRAM)
+#define tile_mem_obj ((CHARBLOCK*)MEM_VRAM_OBJ)
+#define se_mem       ((SCREENBLOCK*)MEM_VRAM)
+#define vid_mem      ((COLOR*)MEM_VRAM)
+#define m3_mem       ((M3LINE*)MEM_VRAM)
+#define m4_mem       ((M4LINE*)MEM_VRAM)
+#define m4_mem_back  ((M4LINE*)MEM_VRAM_BACK)
+#define vid_mem_front ((COLOR*)MEM_VRAM_FRONT)
+#define vid_mem_back  ((COLOR*)MEM_VRAM_BACK)
+
+#define REG_BASE     MEM_IO
+
+#define REG_DISPCNT  *(vu32*)(REG_BASE+0x0000)
+#define REG_DISPSTAT *(vu16*)(REG_BASE+0x0004)
+#define REG_VCOUNT   *(vu16*)(REG_BASE+0x0006)
+#define REG_BG0CNT   *(vu16*)(REG_BASE+0x0008)
+#define REG_BG1CNT   *(vu16*)(REG_BASE+0x000A)
+#define REG_BG2CNT   *(vu16*)(REG_BASE+0x000C)
+#define REG_BG3CNT   *(vu16*)(REG_BASE+0x000E)
+#define REG_BG0HOFS  *(vu16*)(REG_BASE+0x0010)
+#define REG_BG0VOFS  *(vu16*)(REG_BASE+0x0012)
+#define REG_BG1HOFS  *(vu16*)(REG_BASE+0x0014)
+#define REG_BG1VOFS  *(vu16*)(REG_BASE+0x0016)
+#define REG_BG2HOFS  *(vu16*)(REG_BASE+0x0018)
+#define REG_BG2VOFS  *(vu16*)(REG_BASE+0x001A)
+#define REG_BG3HOFS  *(vu16*)(REG_BASE+0x001C)
+#define REG_BG3VOFS  *(vu16*)(REG_BASE+0x001E)
+
+#define REG_DMA3SAD  *(vu32*)(REG_BASE+0x00D4)
+#define REG_DMA3DAD  *(vu32*)(REG_BASE+0x00D8)
+#define REG_DMA3CNT  *(vu32*)(REG_BASE+0x00DC)
+
+#define REG_TM0D     *(vu16*)(REG_BASE+0x0100)
+#define REG_TM0CNT   *(vu16*)(REG_BASE+0x0102)
+#define REG_TM1D     *(vu16*)(REG_BASE+0x0104)
+#define REG_TM1CNT   *(vu16*)(REG_BASE+0x0106)
+#define REG_TM2D     *(vu16*)(REG_BASE+0x0108)
+#define REG_TM2CNT   *(vu16*)(REG_BASE+0x010A)
+#define REG_TM3D     *(vu16*)(REG_BASE+0x010C)
+#define REG_TM3CNT   *(vu16*)(REG_BASE+0x010E)
+
+#define REG_TM0CNT_L REG_TM0D
+#define REG_TM0CNT_H REG_TM0CNT
+#define REG_TM1CNT_L REG_TM1D
+#define REG_TM1CNT_H REG_TM1CNT
+#define REG_TM2CNT_L REG_TM2D
+#define REG_TM2CNT_H REG_TM2CNT
+#define REG_TM3CNT_L REG_TM3D
+#define REG_TM3CNT_H REG_TM3CNT
+
+#define REG_KEYINPUT *(vu16*)(REG_BASE+0x0130)
+#define REG_KEYCNT   *(vu16*)(REG_BASE+0x0132)
+
+#define REG_IE       *(vu16*)(REG_BASE+0x0200)
+#define REG_IF       *(vu16*)(REG_BASE+0x0202)
+#define REG_WAITCNT  *(vu16*)(REG_BASE+0x0204)
+#define REG_IME      *(vu16*)(REG_BASE+0x0208)
+
+#endif
@@ -0,0 +1,43 @@
+/*
+ * Host shim for libtonc: object attribute memory.
+ */
+
+#ifndef TONC_OAM
+#define TONC_OAM
+
+#include "tonc_types.h"
+#include "tonc_memmap.h"
+#include "tonc_memdef.h"
+
+typedef struct OBJ_ATTR
+{
+    u16 attr0;
+    u16 attr1;
+    u16 attr2;
+    s16 fill;
+} ALIGN4 OBJ_ATTR;
+
+#define oam_mem ((OBJ_ATTR*)MEM_OAM)
+
+void oam_init(OBJ_ATTR *obj, uint count);
+void oam_copy(OBJ_ATTR *dst, const OBJ_ATTR *src, uint count);
+
+INLINE OBJ_ATTR *obj_set_attr(OBJ_ATTR *obj, u16 a0, u16 a1, u16 a2)
+{
+    obj->attr0= a0; obj->attr1= a1; obj->attr2= a2;
+    return obj;
+}
+
+INLINE void obj_set_pos(OBJ_ATTR *obj, int x, int y)
+{
+    obj->attr0= (obj->attr0 &~ATTR0_Y_MASK) | ATTR0_Y(y);
+    obj->attr1= (obj->attr1 &~ATTR1_X_MASK) | ATTR1_X(x);
+}
+
+INLINE void obj_hide(OBJ_ATTR *obj)
+{   obj->attr0 |= ATTR0_HIDE;                                   }
+
+INLINE void obj_unhide(OBJ_ATTR *obj, u16 mode)
+{   obj->attr0= (obj->attr0 &~ATTR0_HIDE) | mode;               }
+
+#endif
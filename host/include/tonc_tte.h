@@ -0,0 +1,38 @@
+/*
+ * Host shim for libtonc: text engine. Text is not rasterised on the host;
+ * the calls only track the cursor so the demos compile and run unchanged.
+ */
+
+#ifndef TONC_TTE
+#define TONC_TTE
+
+#include "tonc_types.h"
+
+typedef struct TSurface
+{
+    u8  *data;
+    u32 pitch;
+    u16 width, height;
+    u8  bpp, type;
+} TSurface;
+
+typedef struct TTC
+{
+    TSurface dst;
+    s16 cursorX, cursorY;
+    u16 ink;
+} TTC;
+
+struct TFont;
+
+void tte_init_bmp(int vmode, const struct TFont *font, void (*proc)(uint gid));
+void tte_init_con(void);
+TTC *tte_get_context(void);
+void tte_set_pos(int x, int y);
+void tte_set_ink(u16 ink);
+int tte_write(const char *text);
+void tte_erase_line(void);
+void tte_erase_rect(int left, int top, int right, int bottom);
+int tte_printf(const char *format, ...);
+
+#endif
@@ -0,0 +1,55 @@
+/*
+ * Host shim for libtonc: base types and attributes.
+ */
+
+#ifndef TONC_TYPES
+#define TONC_TYPES
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+typedef uint8_t  u8;
+typedef uint16_t u16;
+typedef uint32_t u32;
+typedef uint64_t u64;
+typedef int8_t   s8;
+typedef int16_t  s16;
+typedef int32_t  s32;
+typedef int64_t  s64;
+
+typedef volatile u8  vu8;
+typedef volatile u16 vu16;
+typedef volatile u32 vu32;
+typedef volatile s16 vs16;
+typedef volatile s32 vs32;
+
+typedef unsigned int uint;
+typedef u16 COLOR;
+typedef void (*fnptr)(void);
+
+typedef struct POINT { int x, y; } POINT, POINT32;
+
+typedef u32 TILE4[8];
+typedef struct { u32 data[8]; } TILE;
+typedef TILE CHARBLOCK[512];
+typedef u16 SE;
+typedef SE SCREENBLOCK[1024];
+typedef u8 M4LINE[240];
+typedef COLOR M3LINE[240];
+
+#define INLINE static inline
+#define ALIGN(n) __attribute__((aligned(n)))
+#define ALIGN4 __attribute__((aligned(4)))
+
+// There is no IWRAM/EWRAM split on the host; everything is plain memory
+#define IWRAM_CODE
+#define EWRAM_CODE
+#define IWRAM_DATA
+#define EWRAM_DATA
+#define EWRAM_BSS
+
+#define BIT(n) ( 1<<(n) )
+#define countof(_array) ( sizeof(_array)/sizeof(_array[0]) )
+
+#endif
@@ -0,0 +1,49 @@
+/*
+ * Host shim for libtonc: video helpers for the bitmap modes.
+ */
+
+#ifndef TONC_VIDEO
+#define TONC_VIDEO
+
+#include "tonc_types.h"
+#include "tonc_memmap.h"
+#include "tonc_memdef.h"
+
+#define SCREEN_WIDTH   240
+#define SCREEN_HEIGHT  160
+#define M3_WIDTH       SCREEN_WIDTH
+#define M3_HEIGHT      SCREEN_HEIGHT
+#define M4_WIDTH       SCREEN_WIDTH
+#define M4_HEIGHT      SCREEN_HEIGHT
+
+#define RGB15(r,g,b)  ((r)+((g)<<5)+((b)<<10))
+
+#define CLR_BLACK   0x0000
+#define CLR_RED     0x001F
+#define CLR_LIME    0x03E0
+#define CLR_BLUE    0x7C00
+#define CLR_WHITE   0x7FFF
+
+extern COLOR *vid_page;
+
+void vid_vsync(void);
+COLOR *vid_flip(void);
+
+void m3_fill(COLOR clr);
+void m3_rect(int left, int top, int right, int bottom, COLOR clr);
+void m4_fill(u8 clrid);
+void m4_rect(int left, int top, int right, int bottom, u8 clrid);
+
+INLINE void m3_plot(int x, int y, COLOR clr)
+{   vid_mem[y*M3_WIDTH+x]= clr;                                 }
+
+INLINE void m4_plot(int x, int y, u8 clrid)
+{
+    u16 *dst= &vid_page[(y*M4_WIDTH+x)>>1];
+    if(x&1)
+        *dst= (*dst& 0xFF) | (clrid<<8);
+    else
+        *dst= (*dst&~0xFF) |  clrid;
+}
+
+#endif
@@ -0,0 +1,25 @@
+/*
+ * Internal interface between the host shim translation units.
+ */
+
+#ifndef HOST_H
+#define HOST_H
+
+#include "tonc_types.h"
+
+enum HostConsts {
+    HOST_CYCLES_PER_FRAME = 280896,
+};
+
+// Emulated cycles since startup; advances one frame per VBlank
+extern u64 host_cycles;
+
+// Called by every wait-for-VBlank entry point (vid_vsync, VBlankIntrWait)
+void host_vblank(void);
+
+// Convert the displayed screen to 24-bit RGB
+void host_render_screen(u8 *rgb);
+
+void host_isr_vblank(void);
+
+#endif
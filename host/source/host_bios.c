@@ -0,0 +1,107 @@
+/*
+ * Host shim BIOS and interrupt services.
+ */
+
+#include "tonc.h"
+#include "host.h"
+
+#include <math.h>
+
+static fnptr vblankIsr;
+
+void irq_init(fnptr isr) {
+    (void)isr;
+    vblankIsr = NULL;
+    REG_IE = 0;
+    REG_IME = 1;
+}
+
+fnptr irq_add(enum eIrqIndex irq_id, fnptr isr) {
+    fnptr old = NULL;
+    if (irq_id == II_VBLANK) {
+        old = vblankIsr;
+        vblankIsr = isr;
+    }
+    irq_enable(irq_id);
+    return old;
+}
+
+fnptr irq_delete(enum eIrqIndex irq_id) {
+    fnptr old = NULL;
+    if (irq_id == II_VBLANK) {
+        old = vblankIsr;
+        vblankIsr = NULL;
+    }
+    irq_disable(irq_id);
+    return old;
+}
+
+void irq_enable(enum eIrqIndex irq_id) {
+    REG_IE |= BIT(irq_id);
+    if (irq_id == II_VBLANK)
+        REG_DISPSTAT |= DSTAT_VBL_IRQ;
+}
+
+void irq_disable(enum eIrqIndex irq_id) {
+    REG_IE &= ~BIT(irq_id);
+}
+
+void host_isr_vblank(void) {
+    if (vblankIsr && REG_IME && (REG_IE & IRQ_VBLANK))
+        vblankIsr();
+}
+
+// The only interrupt the shim raises is VBlank, so every wait ends there
+void Halt(void) {
+    host_vblank();
+}
+
+void IntrWait(u32 flagClear, u32 irq) {
+    (void)flagClear;
+    (void)irq;
+    host_vblank();
+}
+
+void VBlankIntrWait(void) {
+    host_vblank();
+}
+
+s32 Div(s32 num, s32 den) {
+    return num / den;
+}
+
+s32 DivMod(s32 num, s32 den) {
+    return num % den;
+}
+
+u32 Sqrt(u32 num) {
+    return (u32)sqrt((double)num);
+}
+
+u16 ArcTan2(s16 x, s16 y) {
+    double a = atan2(y, x);
+    if (a < 0)
+        a += 2*M_PI;
+    return (u16)(s32)(a * 0x8000 / M_PI);
+}
+
+void CpuSet(const void *src, void *dst, u32 mode) {
+    u32 count = mode & 0x1FFFFF;
+    if (mode & CS_CPY32) {
+        const u32 *s = src;
+        u32 *d = dst;
+        for (u32 i = 0; i < count; i++)
+            d[i] = (mode & CS_FILL) ? s[0] : s[i];
+    } else {
+        const u16 *s = src;
+        u16 *d = dst;
+        for (u32 i = 0; i < count; i++)
+            d[i] = (mode & CS_FILL) ? s[0] : s[i];
+    }
+}
+
+void CpuFastSet(const void *src, void *dst, u32 mode) {
+    // Word count is rounded up to a multiple of 8 like the BIOS does
+    u32 count = ((mode & 0x1FFFFF) + 7) & ~7;
+    CpuSet(src, dst, (mode & CS_FILL) | CS_CPY32 | count);
+}
@@ -0,0 +1,187 @@
+/*
+ * Host shim core: emulated memory, timers, scripted keys and frame dumps.
+ *
+ * Environment:
+ *     GBA_HOST_FRAMES  exit after this many frames (default 600)
+ *     GBA_HOST_KEYS    key script: one "<frames> [KEY ...]" entry per line
+ *     GBA_HOST_DUMP    directory that receives one PPM per displayed frame
+ */
+
+#include "tonc.h"
+#include "gba_host.h"
+#include "host.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+u32 host_io[0x400/4];
+u32 host_pal[0x400/4];
+u32 host_vram[0x18000/4];
+u32 host_oam[0x400/4];
+
+u64 host_cycles;
+
+static u32 frameCount;
+static u32 frameLimit = 600;
+static const char *dumpDir;
+static FILE *keyScript;
+static u32 scriptKeys;
+static u32 scriptFramesLeft;
+
+static const struct { const char *name; u16 key; } keyNames[] = {
+    { "A", KEY_A }, { "B", KEY_B }, { "SELECT", KEY_SELECT },
+    { "START", KEY_START }, { "RIGHT", KEY_RIGHT }, { "LEFT", KEY_LEFT },
+    { "UP", KEY_UP }, { "DOWN", KEY_DOWN }, { "R", KEY_R }, { "L", KEY_L },
+};
+
+static void read_key_script(void) {
+    char line[256];
+    while (scriptFramesLeft == 0 && keyScript
+            && fgets(line, sizeof(line), keyScript)) {
+        char *tok = strtok(line, " \t\r\n");
+        if (!tok || tok[0] == '#')
+            continue;
+        scriptFramesLeft = strtoul(tok, NULL, 10);
+        scriptKeys = 0;
+        while ((tok = strtok(NULL, " \t\r\n"))) {
+            for (u32 i = 0; i < countof(keyNames); i++) {
+                if (!strcmp(tok, keyNames[i].name))
+                    scriptKeys |= keyNames[i].key;
+            }
+        }
+    }
+    if (scriptFramesLeft == 0)
+        scriptKeys = 0;
+}
+
+static void advance_timers(u32 cycles) {
+    static const u32 prescale[4] = { 1, 64, 256, 1024 };
+    static u32 remainder[4];
+    u32 overflow = 0;
+    for (u32 i = 0; i < 4; i++) {
+        vu16 *data = (vu16*)(REG_BASE + 0x100 + 4*i);
+        u16 cnt = data[1];
+        u32 ticks;
+        if (!(cnt & TM_ENABLE)) {
+            overflow = 0;
+            continue;
+        }
+        if (cnt & TM_CASCADE) {
+            ticks = overflow;
+        } else {
+            u32 total = remainder[i] + cycles;
+            ticks = total / prescale[cnt & 3];
+            remainder[i] = total % prescale[cnt & 3];
+        }
+        u32 next = data[0] + ticks;
+        overflow = next >> 16;
+        data[0] = next;
+    }
+}
+
+static void dump_frame(void) {
+    static u8 rgb[SCREEN_WIDTH*SCREEN_HEIGHT*3];
+    char path[512];
+    snprintf(path, sizeof(path), "%s/frame_%05u.ppm", dumpDir, frameCount);
+    FILE *f = fopen(path, "wb");
+    if (!f) {
+        perror(path);
+        exit(1);
+    }
+    host_render_screen(rgb);
+    fprintf(f, "P6\n%d %d\n255\n", SCREEN_WIDTH, SCREEN_HEIGHT);
+    fwrite(rgb, 1, sizeof(rgb), f);
+    fclose(f);
+}
+
+void host_vblank(void) {
+    if (dumpDir)
+        dump_frame();
+    if (++frameCount >= frameLimit)
+        exit(0);
+
+    host_cycles += HOST_CYCLES_PER_FRAME;
+    advance_timers(HOST_CYCLES_PER_FRAME);
+
+    if (scriptFramesLeft)
+        scriptFramesLeft--;
+    read_key_script();
+    REG_KEYINPUT = ~scriptKeys & KEY_MASK;
+
+    REG_VCOUNT = SCREEN_HEIGHT;
+    host_isr_vblank();
+}
+
+__attribute__((constructor))
+static void host_init(void) {
+    const char *env;
+    if ((env = getenv("GBA_HOST_FRAMES")))
+        frameLimit = strtoul(env, NULL, 10);
+    if ((env = getenv("GBA_HOST_KEYS")) && !(keyScript = fopen(env, "r"))) {
+        perror(env);
+        exit(1);
+    }
+    dumpDir = getenv("GBA_HOST_DUMP");
+
+    for (u32 i = 0; i < SIN_LUT_SIZE; i++) {
+        double s = sin(i * 2 * M_PI / 512) * 4096;
+        sin_lut[i] = (s16)(s < 0 ? s - 0.5 : s + 0.5);
+    }
+    div_lut[0] = 0xFFFF;
+    for (u32 i = 1; i < DIV_LUT_SIZE; i++)
+        div_lut[i] = i == 1 ? 0xFFFF : 0x10000 / i;
+
+    read_key_script();
+    REG_KEYINPUT = ~scriptKeys & KEY_MASK;
+}
+
+void memset16(void *dst, u16 hw, uint hwcount) {
+    u16 *d = dst;
+    while (hwcount--)
+        *d++ = hw;
+}
+
+void memcpy16(void *dst, const void *src, uint hwcount) {
+    memcpy(dst, src, hwcount*2);
+}
+
+void memset32(void *dst, u32 wd, uint wcount) {
+    u32 *d = dst;
+    while (wcount--)
+        *d++ = wd;
+}
+
+void memcpy32(void *dst, const void *src, uint wcount) {
+    memcpy(dst, src, wcount*4);
+}
+
+void dma3_cpy(void *dst, const void *src, uint size) {
+    memcpy(dst, src, size);
+}
+
+void dma3_fill(void *dst, u32 fill, uint size) {
+    memset32(dst, fill, size/4);
+}
+
+static struct timespec profileStart;
+
+void profile_start(void) {
+    clock_gettime(CLOCK_MONOTONIC, &profileStart);
+}
+
+uint profile_stop(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (now.tv_sec - profileStart.tv_sec) * 1000000000u
+        + (now.tv_nsec - profileStart.tv_nsec);
+}
+
+u32 host_clock_cycles(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (u64)now.tv_sec * GBA_HOST_CLOCK
+        + (u64)now.tv_nsec * GBA_HOST_CLOCK / 1000000000u;
+}
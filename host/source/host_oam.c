@@ -0,0 +1,15 @@
+/*
+ * Host shim object helpers.
+ */
+
+#include "tonc.h"
+
+void oam_init(OBJ_ATTR *obj, uint count) {
+    for (uint i = 0; i < count; i++)
+        obj_set_attr(&obj[i], ATTR0_HIDE, 0, 0);
+}
+
+void oam_copy(OBJ_ATTR *dst, const OBJ_ATTR *src, uint count) {
+    for (uint i = 0; i < count; i++)
+        dst[i] = src[i];
+}
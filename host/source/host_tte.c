@@ -0,0 +1,61 @@
+/*
+ * Host shim text engine: cursor bookkeeping only.
+ */
+
+#include "tonc.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+u16 __key_curr, __key_prev;
+
+static TTC context;
+
+void tte_init_bmp(int vmode, const struct TFont *font, void (*proc)(uint gid)) {
+    (void)vmode; (void)font; (void)proc;
+    memset(&context, 0, sizeof(context));
+    context.dst.data = (u8*)vid_page;
+    context.dst.pitch = SCREEN_WIDTH;
+    context.dst.width = SCREEN_WIDTH;
+    context.dst.height = SCREEN_HEIGHT;
+    context.dst.bpp = 8;
+}
+
+void tte_init_con(void) {
+}
+
+TTC *tte_get_context(void) {
+    return &context;
+}
+
+void tte_set_pos(int x, int y) {
+    context.cursorX = x;
+    context.cursorY = y;
+}
+
+void tte_set_ink(u16 ink) {
+    context.ink = ink;
+}
+
+// Only the "#{P:x,y}" positioning command is interpreted
+int tte_write(const char *text) {
+    const char *cmd = strstr(text, "#{P:");
+    if (cmd) {
+        char *end;
+        int x = strtol(cmd + 4, &end, 10);
+        int y = *end == ',' ? strtol(end + 1, NULL, 10) : context.cursorY;
+        tte_set_pos(x, y);
+    }
+    return strlen(text);
+}
+
+void tte_erase_line(void) {
+}
+
+void tte_erase_rect(int left, int top, int right, int bottom) {
+    (void)left; (void)top; (void)right; (void)bottom;
+}
+
+int tte_printf(const char *format, ...) {
+    return strlen(format);
+}
@@ -0,0 +1,169 @@
+/*
+ * Host shim video: bitmap-mode drawing and screen conversion, including
+ * the regular backgrounds of mode 0.
+ */
+
+#include "tonc.h"
+#include "host.h"
+
+#include <string.h>
+
+s16 sin_lut[SIN_LUT_SIZE];
+u16 div_lut[DIV_LUT_SIZE];
+
+COLOR *vid_page = vid_mem_back;
+
+void vid_vsync(void) {
+    host_vblank();
+}
+
+COLOR *vid_flip(void) {
+    // The shim's VRAM is not 64 KiB aligned, so pick the page explicitly
+    // instead of toggling the address bit like tonc does
+    vid_page = vid_page == vid_mem_front ? vid_mem_back : vid_mem_front;
+    REG_DISPCNT ^= DCNT_PAGE;
+    return vid_page;
+}
+
+void m3_fill(COLOR clr) {
+    memset16(vid_mem, clr, M3_WIDTH*M3_HEIGHT);
+}
+
+void m3_rect(int left, int top, int right, int bottom, COLOR clr) {
+    for (int y = top; y < bottom; y++)
+        memset16(&vid_mem[y*M3_WIDTH + left], clr, right - left);
+}
+
+void m4_fill(u8 clrid) {
+    memset((u8*)vid_page, clrid, M4_WIDTH*M4_HEIGHT);
+}
+
+void m4_rect(int left, int top, int right, int bottom, u8 clrid) {
+    for (int y = top; y < bottom; y++)
+        memset((u8*)vid_page + y*M4_WIDTH + left, clrid, right - left);
+}
+
+static void put_rgb(u8 *rgb, COLOR clr) {
+    u32 r = clr & 31, g = (clr >> 5) & 31, b = (clr >> 10) & 31;
+    rgb[0] = (r << 3) | (r >> 2);
+    rgb[1] = (g << 3) | (g >> 2);
+    rgb[2] = (b << 3) | (b >> 2);
+}
+
+// Pixel (x, y) of regular background bg in map space, palette index 0 if
+// it is transparent there
+static u32 background_pixel(u32 bg, u32 x, u32 y) {
+    u16 cnt = (&REG_BG0CNT)[bg];
+    const u8 *tiles = (const u8*)tile_mem[(cnt >> BG_CBB_SHIFT) & 3];
+    u32 wide = cnt & BG_REG_64x32 ? 64 : 32;
+    u32 tall = cnt & BG_REG_32x64 ? 64 : 32;
+    x &= wide*8 - 1;
+    y &= tall*8 - 1;
+    // Maps past 32x32 are further 32x32 screenblocks, left to right then
+    // top to bottom
+    u32 block = (cnt >> BG_SBB_SHIFT) & 31;
+    block += (x >= 256) + (y >= 256)*(wide/32);
+    SE se = se_mem[block][(y%256/8)*32 + x%256/8];
+    u32 tx = se & SE_HFLIP ? 7 - x%8 : x%8;
+    u32 ty = se & SE_VFLIP ? 7 - y%8 : y%8;
+    u32 tile = se & SE_ID_MASK;
+    if (cnt & BG_8BPP)
+        return tiles[tile*64 + ty*8 + tx];
+    u8 pair = tiles[tile*32 + ty*4 + tx/2];
+    u32 clrid = tx & 1 ? pair >> 4 : pair & 15;
+    return clrid ? clrid + (se >> SE_PALBANK_SHIFT)*16 : 0;
+}
+
+// Mode 0's enabled backgrounds, back to front: higher priority values
+// first, then higher numbers at the same priority. Mosaic and windows are
+// ignored
+static void render_backgrounds(COLOR *screen) {
+    for (int prio = 3; prio >= 0; prio--) {
+        for (int bg = 3; bg >= 0; bg--) {
+            if (!(REG_DISPCNT & (DCNT_BG0 << bg))
+                    || ((&REG_BG0CNT)[bg] & BG_PRIO_MASK) != prio)
+                continue;
+            u32 hofs = (&REG_BG0HOFS)[2*bg];
+            u32 vofs = (&REG_BG0VOFS)[2*bg];
+            for (u32 y = 0; y < SCREEN_HEIGHT; y++) {
+                for (u32 x = 0; x < SCREEN_WIDTH; x++) {
+                    u32 clrid = background_pixel(bg, x + hofs, y + vofs);
+                    if (clrid)
+                        screen[y*SCREEN_WIDTH + x] = pal_bg_mem[clrid];
+                }
+            }
+        }
+    }
+}
+
+// Regular objects over the bitmap or backgrounds, lowest OAM index on top. Affine
+// objects, blending and priorities against the background are ignored
+static void render_objects(COLOR *screen) {
+    static const u8 sizes[3][4][2] = {
+        { {8, 8}, {16, 16}, {32, 32}, {64, 64} },
+        { {16, 8}, {32, 8}, {32, 16}, {64, 32} },
+        { {8, 16}, {8, 32}, {16, 32}, {32, 64} },
+    };
+    const u8 *tiles = (const u8*)tile_mem_obj;
+    for (int i = 127; i >= 0; i--) {
+        const OBJ_ATTR *obj = &oam_mem[i];
+        u32 shape = obj->attr0 >> 14;
+        if ((obj->attr0 & 0x0300) != 0 || shape == 3)
+            continue;
+        u32 width = sizes[shape][obj->attr1 >> 14][0];
+        u32 height = sizes[shape][obj->attr1 >> 14][1];
+        int left = obj->attr1 & 0x1FF, top = obj->attr0 & 0xFF;
+        if (left >= 256) left -= 512;
+        if (top >= SCREEN_HEIGHT) top -= 256;
+        bool bpp8 = obj->attr0 & ATTR0_8BPP;
+        u32 tile = obj->attr2 & ATTR2_ID_MASK;
+        u32 bank = (obj->attr2 >> 12) * 16;
+        // Tiles per row of the object, in 32 byte units
+        u32 rowTiles = REG_DISPCNT & DCNT_OBJ_1D
+            ? (width/8) * (bpp8 ? 2 : 1) : 32;
+        for (u32 y = 0; y < height; y++) {
+            int sy = top + y;
+            if (sy < 0 || sy >= SCREEN_HEIGHT)
+                continue;
+            for (u32 x = 0; x < width; x++) {
+                int sx = left + x;
+                if (sx < 0 || sx >= SCREEN_WIDTH)
+                    continue;
+                u32 t = tile + (y/8)*rowTiles + (x/8)*(bpp8 ? 2 : 1);
+                u32 offset = (t & 0x3FF)*32;
+                u32 clrid;
+                if (bpp8) {
+                    clrid = tiles[offset + (y%8)*8 + x%8];
+                } else {
+                    u8 pair = tiles[offset + (y%8)*4 + (x%8)/2];
+                    clrid = x & 1 ? pair >> 4 : pair & 15;
+                    if (clrid) clrid += bank;
+                }
+                if (clrid)
+                    screen[sy*SCREEN_WIDTH + sx] = pal_obj_mem[clrid];
+            }
+        }
+    }
+}
+
+void host_render_screen(u8 *rgb) {
+    u32 mode = REG_DISPCNT & DCNT_MODE_MASK;
+    const u8 *page = (const u8*)vid_mem
+        + ((REG_DISPCNT & DCNT_PAGE) ? VRAM_PAGE_SIZE : 0);
+    static COLOR screen[SCREEN_WIDTH*SCREEN_HEIGHT];
+    for (u32 i = 0; i < SCREEN_WIDTH*SCREEN_HEIGHT; i++) {
+        COLOR clr = pal_bg_mem[0];
+        if (mode == 3)
+            clr = vid_mem[i];
+        else if (mode == 4)
+            clr = pal_bg_mem[page[i]];
+        screen[i] = clr;
+    }
+    if (mode == 0)
+        render_backgrounds(screen);
+    if (REG_DISPCNT & DCNT_OBJ)
+        render_objects(screen);
+    for (u32 i = 0; i < SCREEN_WIDTH*SCREEN_HEIGHT; i++) {
+        put_rgb(&rgb[3*i], screen[i]);
+    }
+}
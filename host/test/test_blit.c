@@ -0,0 +1,116 @@
+/*
+ * Checks common/source/blit.c against a plain per-pixel reference: random
+ * tiles, spans and masked sprites, at odd and even x and over a page of
+ * random pixels, must leave vid_page exactly as plotting one byte at a
+ * time would, pixels outside what they draw included. Every span of width
+ * 0 to 9 from each of the four x offsets in a word also runs, covering
+ * both parities of start and end.
+ */
+#include "blit.h"
+
+#include <tonc.h>
+#include <stdio.h>
+#include <string.h>
+
+enum TestConsts {
+    BLITS = 200000,
+    MAX_SPRITE_SIZE = 16,
+    // Widths of the exhaustive short spans
+    SHORT_SPAN_MAX = 9,
+    MAX_REPORTS = 5,
+};
+
+static int failures;
+static u32 rngState = 0x2545F491;
+static u8 reference[M4_WIDTH*M4_HEIGHT];
+
+static u32 next_random(void) {
+    rngState ^= rngState << 13;
+    rngState ^= rngState >> 17;
+    rngState ^= rngState << 5;
+    return rngState;
+}
+
+static void tile(void) {
+    int x = next_random() % (M4_WIDTH/4 - 1) * 4;
+    int y = next_random() % (M4_HEIGHT - 8);
+    u8 clrid = next_random();
+    blit_tile(x, y, clrid);
+    for (int j = 0; j < 8; j++) {
+        memset(&reference[(y + j)*M4_WIDTH + x], clrid, 8);
+    }
+}
+
+static void span_at(int x, int y, int width) {
+    u8 clrid = next_random();
+    blit_span(x, y, width, clrid);
+    if (width > 0)
+        memset(&reference[y*M4_WIDTH + x], clrid, width);
+}
+
+static void span(void) {
+    int x = next_random() % M4_WIDTH;
+    int y = next_random() % M4_HEIGHT;
+    span_at(x, y, next_random() % (M4_WIDTH - x + 1));
+}
+
+// About a third of the sprite's pixels are transparent
+static void masked(void) {
+    u8 src[MAX_SPRITE_SIZE*MAX_SPRITE_SIZE];
+    int width = 1 + next_random() % MAX_SPRITE_SIZE;
+    int height = 1 + next_random() % MAX_SPRITE_SIZE;
+    for (int i = 0; i < width*height; i++) {
+        src[i] = next_random() % 3 ? 1 + next_random() % 255 : 0;
+    }
+    int x = next_random() % (M4_WIDTH - width + 1);
+    int y = next_random() % (M4_HEIGHT - height + 1);
+    blit_masked(x, y, src, width, height);
+    for (int j = 0; j < height; j++) {
+        for (int i = 0; i < width; i++) {
+            if (src[j*width + i])
+                reference[(y + j)*M4_WIDTH + x + i] = src[j*width + i];
+        }
+    }
+}
+
+int main(void) {
+    u8 *page = (u8*)vid_page;
+    for (int i = 0; i < M4_WIDTH*M4_HEIGHT; i++) {
+        reference[i] = page[i] = next_random();
+    }
+    for (int x = 0; x < 4; x++) {
+        for (int width = 0; width <= SHORT_SPAN_MAX; width++) {
+            span_at(100 + x, 7, width);
+            if (memcmp(reference, page, sizeof reference)) {
+                printf("FAIL span at x = %d, width %d differs from the "
+                    "reference\n", 100 + x, width);
+                failures++;
+                memcpy(reference, page, sizeof reference);
+            }
+        }
+    }
+
+    static const char *const kinds[] = { "tile", "span", "masked" };
+    for (int i = 0; i < BLITS && failures < MAX_REPORTS; i++) {
+        u32 kind = next_random() % 3;
+        if (kind == 0)
+            tile();
+        else if (kind == 1)
+            span();
+        else
+            masked();
+        if (memcmp(reference, page, sizeof reference)) {
+            printf("FAIL %s blit %d differs from the reference\n",
+                   kinds[kind], i);
+            failures++;
+            memcpy(reference, page, sizeof reference);
+        }
+    }
+
+    if (failures) {
+        printf("%d failures\n", failures);
+        return 1;
+    }
+    printf("blit ok\n");
+    return 0;
+}
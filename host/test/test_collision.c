@@ -0,0 +1,222 @@
+/*
+ * Checks m4-raycaster's move_player() (collision.iwram.c). Moves with a
+ * known outcome must end exactly there: a free move lands on its target,
+ * a move into a wall keeps the part along it and stops the part into it
+ * at the contact distance, a move past a wall's corner slides around it,
+ * and a long move stops at the first wall in its way. Random moves, slow
+ * ones and moves of many tiles at once, must never leave the player
+ * overlapping a wall, and must never carry it through one. Those run on
+ * the raycaster's own map and on a larger one split in two by a wall,
+ * which the player must stay on its side of.
+ */
+#include "../../m4-raycaster/source/collision.iwram.c"
+#include "../../m4-raycaster/source/world_map.c"
+
+#include <math.h>
+#include <stdio.h>
+
+enum TestConsts {
+    MOVES = 300000,
+    // The split map, in cells and chunks
+    SPLIT_SIZE = 3*MAP_CHUNK_SIZE,
+    SPLIT_CHUNKS = 3,
+    SPLIT_WALL_X = SPLIT_SIZE/2,
+    MAX_REPORTS = 5,
+};
+
+static int failures;
+static u32 rngState = 0x2545F491;
+
+static u32 next_random(void) {
+    rngState ^= rngState << 13;
+    rngState ^= rngState >> 17;
+    rngState ^= rngState << 5;
+    return rngState;
+}
+
+static void fail(const char *what, s32 x, s32 y, s32 dx, s32 dy, POINT p) {
+    if (failures++ < MAX_REPORTS)
+        printf("FAIL %s: (%d, %d) by (%d, %d) -> (%d, %d)\n", what, x, y,
+            dx, dy, p.x, p.y);
+}
+
+// Whether the player circle at (x, y) cuts into a wall cell, in doubles
+static bool overlaps(s32 x, s32 y) {
+    double px = x/(double)FIXED_ONE;
+    double py = y/(double)FIXED_ONE;
+    double r = PLAYER_RADIUS/(double)FIXED_ONE;
+    int cx = (int)floor(px/TILE_SIZE);
+    int cy = (int)floor(py/TILE_SIZE);
+    for (int j = cy - 1; j <= cy + 1; j++) {
+        for (int i = cx - 1; i <= cx + 1; i++) {
+            if (!map_stream_solid(i, j))
+                continue;
+            double left = i*TILE_SIZE, top = j*TILE_SIZE;
+            double qx = px < left ? left : px > left + TILE_SIZE ? left + TILE_SIZE : px;
+            double qy = py < top ? top : py > top + TILE_SIZE ? top + TILE_SIZE : py;
+            if ((qx - px)*(qx - px) + (qy - py)*(qy - py) < r*r)
+                return true;
+        }
+    }
+    return false;
+}
+
+// Random walks from (x, y). Every third move is up to maxTiles long
+static void walk(const char *name, s32 x, s32 y, s32 maxTiles, bool split) {
+    int before = failures;
+    bool left = x < INT_TO_FIXED(SPLIT_WALL_X*TILE_SIZE);
+    for (int i = 0; i < MOVES; i++) {
+        double angle = next_random()/4294967296.0*2*M_PI;
+        double length = next_random() % 3 == 0
+            ? (1 + next_random() % (maxTiles*TILE_SIZE))*(double)FIXED_ONE
+            : (next_random() % 3)*FIXED_ONE/2.0;
+        s32 dx = (s32)(cos(angle)*length);
+        s32 dy = (s32)(sin(angle)*length);
+        POINT p = move_player(x, y, dx, dy);
+        if (overlaps(p.x, p.y))
+            fail(name, x, y, dx, dy, p);
+        if (split && (p.x < INT_TO_FIXED(SPLIT_WALL_X*TILE_SIZE)) != left)
+            fail("through the wall", x, y, dx, dy, p);
+        x = p.x;
+        y = p.y;
+    }
+    printf("%s: %d failures in %d moves\n", name, failures - before, MOVES);
+}
+
+static u32 testOffsets[SPLIT_CHUNKS*SPLIT_CHUNKS];
+static u8 testData[SPLIT_CHUNKS*SPLIT_CHUNKS][1 + MAP_CHUNK_CELLS];
+
+// A SPLIT_SIZE square map with walls round the edge and where wall() says
+static const ChunkedMap *test_map(bool (*wall)(u32 x, u32 y)) {
+    static ChunkedMap map = { SPLIT_SIZE, SPLIT_SIZE, SPLIT_CHUNKS,
+        SPLIT_CHUNKS, testOffsets, testData[0] };
+    for (u32 c = 0; c < SPLIT_CHUNKS*SPLIT_CHUNKS; c++) {
+        testOffsets[c] = c*(1 + MAP_CHUNK_CELLS);
+        testData[c][0] = MAP_CHUNK_RAW;
+    }
+    for (u32 y = 0; y < SPLIT_SIZE; y++) {
+        for (u32 x = 0; x < SPLIT_SIZE; x++) {
+            bool edge = x == 0 || y == 0 || x == SPLIT_SIZE - 1
+                || y == SPLIT_SIZE - 1;
+            u32 c = (y/MAP_CHUNK_SIZE)*SPLIT_CHUNKS + x/MAP_CHUNK_SIZE;
+            testData[c][1 + (y%MAP_CHUNK_SIZE)*MAP_CHUNK_SIZE
+                + x%MAP_CHUNK_SIZE] = edge || wall(x, y);
+        }
+    }
+    // Drop the chunks of whatever map was streamed before
+    map_stream_open(&map);
+    return &map;
+}
+
+// A wall down the middle, and a scatter of pillars
+static bool split_wall(u32 x, u32 y) {
+    return x == SPLIT_WALL_X || (x % 5 == 2 && y % 7 == 3);
+}
+
+// Nothing but the edge
+static bool no_wall(u32 x, u32 y) {
+    (void)x;
+    (void)y;
+    return false;
+}
+
+// Two walls across the map, at columns 20 and 30, and a pillar at (10, 10)
+static bool two_walls(u32 x, u32 y) {
+    return x == 20 || x == 30 || (x == 10 && y == 10);
+}
+
+static s32 cell_edge(s32 cell) {
+    return INT_TO_FIXED(cell*TILE_SIZE);
+}
+
+static void expect(const char *what, s32 x, s32 y, s32 dx, s32 dy,
+    s32 wantX, s32 wantY)
+{
+    POINT p = move_player(x, y, dx, dy);
+    if (p.x != wantX || p.y != wantY) {
+        if (failures++ < MAX_REPORTS)
+            printf("FAIL %s: (%d, %d) by (%d, %d) -> (%d, %d), want (%d, %d)\n",
+                what, x, y, dx, dy, p.x, p.y, wantX, wantY);
+    }
+}
+
+// Moves whose outcome is known exactly
+static void exact_moves(void) {
+    int before = failures;
+    s32 centre = INT_TO_FIXED(TILE_SIZE/2);
+    // Where the player stops against the west face of column 20
+    s32 stopX = cell_edge(20) - PLAYER_RADIUS - CONTACT_SKIN;
+
+    // Free moves, short and split into pieces, land on their target
+    test_map(no_wall);
+    s32 x = cell_edge(20) + centre, y = cell_edge(20) + centre;
+    for (int i = 0; i < 1000; i++) {
+        s32 dx = (s32)(next_random() % (16*TILE_SIZE_FIXED)) - 8*TILE_SIZE_FIXED;
+        s32 dy = (s32)(next_random() % (16*TILE_SIZE_FIXED)) - 8*TILE_SIZE_FIXED;
+        expect("free move", x, y, dx, dy, x + dx, y + dy);
+    }
+
+    test_map(two_walls);
+    y = cell_edge(24) + centre;
+    // Straight into the wall stops at the contact distance
+    expect("into a wall", cell_edge(17), y, 4*TILE_SIZE_FIXED, 0, stopX, y);
+    // At a slant the part along the wall is kept, short and long moves
+    for (s32 dy = -3*TILE_SIZE_FIXED; dy <= 3*TILE_SIZE_FIXED;
+        dy += TILE_SIZE_FIXED/4)
+    {
+        expect("along a wall", cell_edge(17), y, 4*TILE_SIZE_FIXED, dy,
+            stopX, y + dy);
+        expect("long along a wall", cell_edge(13), y, 9*TILE_SIZE_FIXED, dy,
+            stopX, y + dy);
+    }
+    // Both ways: from the east the stop is off the east face of column 20
+    expect("into a wall from the east", cell_edge(23), y, -2*TILE_SIZE_FIXED,
+        TILE_SIZE_FIXED, cell_edge(21) + PLAYER_RADIUS + CONTACT_SKIN,
+        y + TILE_SIZE_FIXED);
+    // A long, fast move stops at the first wall, not at column 30
+    expect("past the first wall", cell_edge(13), y, 25*TILE_SIZE_FIXED, 0,
+        stopX, y);
+    expect("past the first wall from the east", cell_edge(37), y,
+        -25*TILE_SIZE_FIXED, 0, cell_edge(31) + PLAYER_RADIUS + CONTACT_SKIN, y);
+
+    // Clipping the pillar's corner slides up round it and on past, where
+    // stopping at the contact would leave the player in front of it and
+    // ignoring the pillar would leave the player's path straight
+    s32 top = cell_edge(10);
+    for (s32 offset = PLAYER_RADIUS/2; offset < PLAYER_RADIUS;
+        offset += PLAYER_RADIUS/8)
+    {
+        s32 startX = cell_edge(7);
+        s32 startY = top - offset;
+        s32 dx = 8*TILE_SIZE_FIXED;
+        POINT p = move_player(startX, startY, dx, 0);
+        if (p.x <= cell_edge(11) + PLAYER_RADIUS || p.y >= startY
+            || p.y < top - PLAYER_RADIUS - CONTACT_SKIN - TILE_SIZE_FIXED
+            || overlaps(p.x, p.y))
+        {
+            fail("round a corner", startX, startY, dx, 0, p);
+        }
+    }
+    printf("exact moves: %d failures\n", failures - before);
+}
+
+int main(void) {
+    exact_moves();
+
+    map_stream_open(&worldMap);
+    walk("world map", PLAYER_START_X, PLAYER_START_Y, 8, false);
+
+    test_map(split_wall);
+    s32 centre = INT_TO_FIXED(TILE_SIZE/2);
+    walk("split map, left", INT_TO_FIXED(4*TILE_SIZE) + centre,
+        INT_TO_FIXED(4*TILE_SIZE) + centre, 40, true);
+    walk("split map, right", INT_TO_FIXED((SPLIT_WALL_X + 4)*TILE_SIZE) + centre,
+        INT_TO_FIXED(30*TILE_SIZE) + centre, 40, true);
+
+    if (failures) {
+        printf("%d failures\n", failures);
+        return 1;
+    }
+    printf("collision ok\n");
+    return 0;
+}
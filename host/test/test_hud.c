@@ -0,0 +1,92 @@
+/*
+ * Checks common/source/hud.c: values too wide for their slot saturate to
+ * 9s instead of losing digits, no slot runs past the screen's edge, and
+ * OAM only changes in hud_commit(). Reads the glyphs back from OAM.
+ */
+#include "hud.h"
+#include "math_utils.h"
+#include "tonc.h"
+
+#include <stdio.h>
+#include <string.h>
+
+static int failures;
+
+// What the width objects from first show, '.' for a hidden one
+static void shown(u32 first, u32 width, char *text) {
+    for (u32 i = 0; i < width; i++) {
+        const OBJ_ATTR *o = &oam_mem[HUD_OAM_FIRST + first + i];
+        u32 glyph = (o->attr2 & ATTR2_ID_MASK) - HUD_TILE_FIRST;
+        text[i] = o->attr0 & ATTR0_HIDE ? '.' : glyph == 10 ? '-' : '0' + glyph;
+    }
+    text[width] = '\0';
+}
+
+// Slot 0 takes the first 3 objects
+static void expect(int slot, u32 width, s32 value, const char *want) {
+    char got[HUD_MAX_CHARS + 1];
+    char before[HUD_MAX_CHARS + 1];
+    shown(0, width, before);
+    hud_set(slot, value);
+    shown(0, width, got);
+    if (strcmp(got, before)) {
+        printf("FAIL slot %d value %d: OAM changed before the commit\n",
+            slot, value);
+        failures++;
+    }
+    hud_commit();
+    shown(0, width, got);
+    if (strcmp(got, want)) {
+        printf("FAIL slot %d value %d: shows \"%s\", want \"%s\"\n", slot,
+            value, got, want);
+        failures++;
+    }
+}
+
+int main(void) {
+    REG_DISPCNT = DCNT_MODE4 | DCNT_BG2 | DCNT_OBJ | DCNT_OBJ_1D;
+    tte_init_bmp(4, NULL, NULL);
+    hud_init(CLR_WHITE);
+
+    // "ab: " is 32 pixels, so the value starts at x = 32 and has 3 places
+    int slot = hud_add(0, 0, "ab: ", 3);
+    expect(slot, 3, 0, "0..");
+    expect(slot, 3, 42, "42.");
+    expect(slot, 3, 999, "999");
+    expect(slot, 3, 1000, "999");
+    expect(slot, 3, MATH_S32_MAX, "999");
+    expect(slot, 3, -99, "-99");
+    expect(slot, 3, -100, "-99");
+    expect(slot, 3, MATH_S32_MIN, "-99");
+    expect(slot, 3, 7, "7..");
+
+    // Room for 2 characters between x = 224 and the edge, not the 8 asked for
+    int edge = hud_add(SCREEN_WIDTH - 3*HUD_GLYPH_WIDTH, 10, "x", 8);
+    const OBJ_ATTR *obj = &oam_mem[HUD_OAM_FIRST + 3];
+    hud_set(edge, -123456);
+    hud_commit();
+    for (u32 i = 0; i < 2; i++) {
+        u32 right = (obj[i].attr1 & ATTR1_X_MASK) + HUD_GLYPH_WIDTH;
+        if (right > SCREEN_WIDTH) {
+            printf("FAIL character %u ends at x = %u\n", i, right);
+            failures++;
+        }
+    }
+    char text[3];
+    shown(3, 2, text);
+    if (strcmp(text, "-9")) {
+        printf("FAIL edge slot shows \"%s\", want \"-9\"\n", text);
+        failures++;
+    }
+    if (hud_add(SCREEN_WIDTH, 20, "", 4) < 0 || !(obj[2].attr0 & ATTR0_HIDE)) {
+        printf("FAIL a slot past the edge takes objects\n");
+        failures++;
+    }
+
+    if (failures) {
+        printf("%d failures\n", failures);
+        return 1;
+    }
+    printf("hud ok\n");
+    return 0;
+}
@@ -0,0 +1,62 @@
+/*
+ * Checks common/source/map.c: the solid mask matches the tiles for widths
+ * on and off a word boundary, cells outside read as solid, and oversize
+ * maps are refused rather than read at the wrong stride.
+ */
+#include "map.h"
+
+#include <stdio.h>
+
+static int failures;
+
+static u8 tiles[(MAP_MAX_SIZE + 1)*3];
+static u32 solid[MAP_SOLID_WORDS(MAP_MAX_SIZE + 1, 3)];
+
+static void check_size(u32 width, u32 height) {
+    for (u32 i = 0; i < width*height; i++) {
+        tiles[i] = (i*7 + i/5) % 3 == 0;
+    }
+    Map map;
+    if (!map_init(&map, width, height, tiles, solid)) {
+        printf("FAIL %ux%u refused\n", width, height);
+        failures++;
+        return;
+    }
+    for (s32 y = -1; y <= (s32)height; y++) {
+        for (s32 x = -33; x <= (s32)width + 33; x++) {
+            bool inside = x >= 0 && y >= 0 && x < (s32)width && y < (s32)height;
+            bool want = !inside || tiles[y*width + x];
+            bool bit = (map_solid_bits(&map, x, y, 1) & 1) != 0;
+            if (map_solid(&map, x, y) != want || bit != want) {
+                printf("FAIL %ux%u cell (%d, %d)\n", width, height, x, y);
+                failures++;
+                return;
+            }
+        }
+    }
+}
+
+int main(void) {
+    check_size(8, 8);
+    check_size(31, 3);
+    check_size(33, 3);
+    check_size(MAP_MAX_SIZE, 3);
+
+    Map map;
+    if (map_init(&map, MAP_MAX_SIZE + 1, 3, tiles, solid)
+            || map_init(&map, 3, MAP_MAX_SIZE + 1, tiles, solid)) {
+        printf("FAIL oversize map accepted\n");
+        failures++;
+    }
+    if (!map_solid(&map, 0, 0) || map.width || map.height) {
+        printf("FAIL refused map is not empty and solid\n");
+        failures++;
+    }
+
+    if (failures) {
+        printf("%d failures\n", failures);
+        return 1;
+    }
+    printf("map ok\n");
+    return 0;
+}
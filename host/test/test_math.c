@@ -0,0 +1,293 @@
+/*
+ * Checks common/include/math_utils.h against double precision. Every Q
+ * format is swept over edge inputs (0, 1 ulp either side of 0 and of 1.0,
+ * the s32 bounds, denominators next to 0) and pseudo-random values of
+ * every magnitude. Each function must stay within the error stated for it
+ * below. Prints the first failures and exits non-zero if there are any.
+ */
+#include "math_utils.h"
+
+#include <math.h>
+#include <stdio.h>
+
+enum TestConsts {
+    RANDOM_VALUES = 4000,
+    // Failures printed per function before the rest are only counted
+    MAX_REPORTS = 5,
+    // atan2 error bound, tonc units (0x10000 per turn)
+    ATAN2_MAX_ERROR = 18,
+    ANGLE_TURN = 0x10000,
+};
+
+// Largest quotient math_udiv_lut() is asked for, see its comment
+#define UDIV_MAX_QUOTIENT (4294967296.0 - 32768.0)
+
+static int failures;
+static int reports;
+
+static void fail(const char *what, const char *detail, double got,
+    double want)
+{
+    failures++;
+    if (reports++ < MAX_REPORTS)
+        printf("FAIL %s %s: got %.3f, want %.3f\n", what, detail, got, want);
+}
+
+static u32 rngState = 0x2545F491;
+
+// xorshift32, as in snake
+static u32 next_random(void) {
+    rngState ^= rngState << 13;
+    rngState ^= rngState >> 17;
+    rngState ^= rngState << 5;
+    return rngState;
+}
+
+// Any magnitude from 1 to 2^31 - 1, either sign, about evenly in log scale
+static s32 random_value(void) {
+    u32 bits = next_random() % 31;
+    s32 v = (s32)(next_random() >> (31 - bits));
+    return next_random() & 1 ? -v : v;
+}
+
+static s32 values[64 + RANDOM_VALUES];
+static int valueCount;
+
+// Edge values of a format with shift fraction bits, then random ones
+static void make_values(int shift) {
+    s32 one = 1 << shift;
+    const s32 edges[] = {
+        0, 1, -1, 2, -2, 3, -3,
+        one, -one, one - 1, -one + 1, one + 1, -one - 1,
+        one/2, -one/2, 2*one, -2*one,
+        MATH_S32_MAX, MATH_S32_MIN, MATH_S32_MAX - 1, MATH_S32_MIN + 1,
+        MATH_S32_MAX >> shift, -(MATH_S32_MAX >> shift),
+        46340, -46340, 46341, -46341,
+    };
+    valueCount = 0;
+    for (u32 i = 0; i < countof(edges); i++) {
+        values[valueCount++] = edges[i];
+    }
+    for (int i = 0; i < RANDOM_VALUES; i++) {
+        values[valueCount++] = random_value();
+    }
+}
+
+static double clamp_s32(double x) {
+    return x > MATH_S32_MAX ? MATH_S32_MAX : x < MATH_S32_MIN ? MATH_S32_MIN : x;
+}
+
+// Reference udiv of a format: floor(num 2^shift / den)
+static double udiv_ref(u32 num, u32 den, int shift) {
+    return floor(ldexp(num, shift) / den);
+}
+
+// The table divide is within 1 + q/2^18 of the exact quotient q either way,
+// which is what math_udiv_lut() promises
+static void check_udiv(const char *what, double got, double want,
+    const char *detail)
+{
+    if (fabs(got - want) > 1 + want/(1 << 18))
+        fail(what, detail, got, want);
+}
+
+static void check_math_udiv_lut(void) {
+    reports = 0;
+    char detail[64];
+    for (int i = 0; i < 200000; i++) {
+        u32 den = next_random() >> (next_random() % 32);
+        if (!den)
+            den = 1;
+        u32 shift = next_random() % 31;
+        // Keep the quotient clear of the top of u32
+        double maxNum = floor(ldexp((double)den, -(s32)shift) * UDIV_MAX_QUOTIENT);
+        u32 num = next_random() >> (next_random() % 32);
+        if (num > maxNum)
+            num = (u32)maxNum;
+        sprintf(detail, "(%u << %u) / %u", num, shift, den);
+        check_udiv("math_udiv_lut", math_udiv_lut(num, den, shift),
+            udiv_ref(num, den, shift), detail);
+    }
+    // Denominators next to 0 and at the top of the range
+    const u32 dens[] = { 1, 2, 3, 0x7FFFFFFF, 0x80000000, 0xFFFFFFFF };
+    for (u32 i = 0; i < countof(dens); i++) {
+        for (u32 shift = 0; shift <= 30; shift++) {
+            double maxNum = floor(ldexp((double)dens[i], -(s32)shift)
+                * UDIV_MAX_QUOTIENT);
+            u32 num = maxNum > 0xFFFFFFFFu ? 0xFFFFFFFFu : (u32)maxNum;
+            sprintf(detail, "(%u << %u) / %u", num, shift, dens[i]);
+            check_udiv("math_udiv_lut", math_udiv_lut(num, dens[i], shift),
+                udiv_ref(num, dens[i], shift), detail);
+        }
+    }
+}
+
+// Exact: the root rounded down, checked by squaring
+static void check_math_isqrt64(void) {
+    reports = 0;
+    char detail[64];
+    u64 inputs[4000];
+    u32 count = 0;
+    const u64 edges[] = { 0, 1, 2, 3, 4, 0xFFFFFFFFu, (u64)1 << 62,
+        ~(u64)0, ~(u64)0 - 1, (u64)0xFFFFFFFFu*0xFFFFFFFFu };
+    for (u32 i = 0; i < countof(edges); i++) {
+        inputs[count++] = edges[i];
+    }
+    while (count < countof(inputs)) {
+        u64 x = ((u64)next_random() << 32 | next_random()) >> (next_random() % 64);
+        inputs[count++] = x;
+        // And 1 either side of its square root squared
+        u64 r = (u64)sqrtl((long double)x);
+        if (count < countof(inputs) && r*r > 0)
+            inputs[count++] = r*r - 1;
+    }
+    for (u32 i = 0; i < count; i++) {
+        u64 x = inputs[i];
+        u64 r = math_isqrt64(x);
+        bool low = r*r <= x;
+        bool high = r == 0xFFFFFFFFu || (r + 1)*(r + 1) > x;
+        sprintf(detail, "of %llu", (unsigned long long)x);
+        if (!low || !high)
+            fail("math_isqrt64", detail, r, floorl(sqrtl((long double)x)));
+    }
+}
+
+// Within ATAN2_MAX_ERROR of the exact angle, around the whole circle
+static void check_math_atan2(void) {
+    reports = 0;
+    char detail[64];
+    const s32 axes[][2] = {
+        { 1, 0 }, { 0, 1 }, { -1, 0 }, { 0, -1 },
+        { MATH_S32_MAX, 0 }, { 0, MATH_S32_MAX },
+        { -MATH_S32_MAX, 0 }, { 0, -MATH_S32_MAX },
+        { MATH_S32_MAX, MATH_S32_MAX }, { -MATH_S32_MAX, MATH_S32_MAX },
+        { -MATH_S32_MAX, -MATH_S32_MAX }, { MATH_S32_MAX, -MATH_S32_MAX },
+        { MATH_S32_MAX, 1 }, { 1, MATH_S32_MAX }, { -1, -MATH_S32_MAX },
+    };
+    static s32 points[200000][2];
+    u32 count = 0;
+    for (u32 i = 0; i < countof(axes); i++) {
+        points[count][0] = axes[i][0];
+        points[count++][1] = axes[i][1];
+    }
+    while (count < countof(points)) {
+        points[count][0] = random_value();
+        points[count++][1] = random_value();
+    }
+    int quadrants[4] = { 0 };
+    for (u32 i = 0; i < count; i++) {
+        s32 x = points[i][0], y = points[i][1];
+        if (!x && !y)
+            continue;
+        quadrants[(x < 0) + 2*(y < 0)]++;
+        double want = atan2((double)y, (double)x)*ANGLE_TURN/(2*M_PI);
+        if (want < 0)
+            want += ANGLE_TURN;
+        double got = math_atan2(x, y);
+        double error = fabs(got - want);
+        if (error > ANGLE_TURN/2)
+            error = ANGLE_TURN - error;
+        sprintf(detail, "(%d, %d)", x, y);
+        if (error > ATAN2_MAX_ERROR)
+            fail("math_atan2", detail, got, want);
+    }
+    for (int q = 0; q < 4; q++) {
+        if (!quadrants[q])
+            fail("math_atan2", "quadrant not covered", q, 0);
+    }
+    if (math_atan2(0, 0) != 0)
+        fail("math_atan2", "(0, 0)", math_atan2(0, 0), 0);
+}
+
+/*
+ * The q*_ functions of one format, generated like the format itself.
+ * Stated errors, in LSB of the format:
+ * to_int       exact, halves away from zero
+ * floor        exact
+ * mul          exact floor of the product where it fits in s32
+ * mul_sat      as mul, saturated exactly to the s32 bounds
+ * div          exact, rounded towards zero, where it fits in s32
+ * div_lut      as math_udiv_lut on the magnitudes, sign applied after
+ * recip        within 1 + q/2^18 of the exact 1/x, for 1/x inside the
+ *              format's range
+ * sqrt         exact floor of the root, 0 for x <= 0
+ */
+#define CHECK_Q(q, shift) \
+static void check_##q(void) { \
+    const char *name = #q; \
+    char what[32]; \
+    char detail[64]; \
+    const double one = 1 << (shift); \
+    reports = 0; \
+    make_values(shift); \
+    for (int i = 0; i < valueCount; i++) { \
+        s32 a = values[i]; \
+        sprintf(detail, "of %d", a); \
+        sprintf(what, "%s_to_int", name); \
+        double want = a >= 0 ? floor(a/one + 0.5) : -floor(-(double)a/one + 0.5); \
+        if (q##_to_int(a) != want) \
+            fail(what, detail, q##_to_int(a), want); \
+        sprintf(what, "%s_floor", name); \
+        if (q##_floor(a) != floor(a/one)) \
+            fail(what, detail, q##_floor(a), floor(a/one)); \
+        sprintf(what, "%s_sqrt", name); \
+        want = a > 0 ? floor(sqrt(a*one)) : 0; \
+        if (q##_sqrt(a) != want) \
+            fail(what, detail, q##_sqrt(a), want); \
+        sprintf(what, "%s_recip", name); \
+        want = one*one/a; \
+        if (a && fabs(want) < MATH_S32_MAX) { \
+            double got = q##_recip(a); \
+            if (fabs(got - want) > 1 + fabs(want)/(1 << 18)) \
+                fail(what, detail, got, want); \
+        } \
+    } \
+    for (int i = 0; i < valueCount; i++) { \
+        for (int j = 0; j < valueCount; j += i < 64 ? 1 : 61) { \
+            s32 a = values[i]; \
+            s32 b = values[j]; \
+            sprintf(detail, "of %d, %d", a, b); \
+            double product = floor((double)a*b/one); \
+            sprintf(what, "%s_mul", name); \
+            if (product == clamp_s32(product) && q##_mul(a, b) != product) \
+                fail(what, detail, q##_mul(a, b), product); \
+            sprintf(what, "%s_mul_sat", name); \
+            if (q##_mul_sat(a, b) != clamp_s32(product)) \
+                fail(what, detail, q##_mul_sat(a, b), clamp_s32(product)); \
+            if (!b) \
+                continue; \
+            double quotient = trunc((double)a*one/b); \
+            if (quotient != clamp_s32(quotient)) \
+                continue; \
+            sprintf(what, "%s_div", name); \
+            if (q##_div(a, b) != quotient) \
+                fail(what, detail, q##_div(a, b), quotient); \
+            if (a == MATH_S32_MIN || b == MATH_S32_MIN) \
+                continue; \
+            sprintf(what, "%s_div_lut", name); \
+            double got = q##_div_lut(a, b); \
+            check_udiv(what, fabs(got), fabs(quotient), detail); \
+            if (got && (got < 0) != (quotient < 0)) \
+                fail(what, detail, got, quotient); \
+        } \
+    } \
+}
+
+CHECK_Q(q8, 8)
+CHECK_Q(q12, 12)
+CHECK_Q(q16, 16)
+
+int main(void) {
+    check_math_udiv_lut();
+    check_math_isqrt64();
+    check_math_atan2();
+    check_q8();
+    check_q12();
+    check_q16();
+    if (failures) {
+        printf("%d failures\n", failures);
+        return 1;
+    }
+    printf("math_utils ok\n");
+    return 0;
+}
@@ -0,0 +1,258 @@
+/*
+ * Checks snake's board state (snake.c): over a long random game, with
+ * growth, bites and the ring wrapping around, and over a game that grows
+ * the snake to cover the board, the segments stay in distinct,
+ * neighbouring cells, the occupancy bitmap matches them and the free-cell
+ * set holds the rest. Food lands uniformly on free cells, the same seed
+ * giving the same placements. The mode 3 screen always shows the snake,
+ * food and floor the state holds, and a frame without a move draws
+ * nothing.
+ */
+#define main snake_main
+#include "../../snake/source/snake.c"
+#undef main
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+enum TestConsts {
+    MOVES = 1000000,
+    // Food placements per free cell in the uniformity check
+    PICKS_PER_CELL = 10000,
+    // Moves between full screen checks, besides those after bites and wins
+    SCREEN_CHECK_MOVES = 97,
+};
+
+static int failures;
+static u32 steerState = 0x9E3779B9;
+
+static u32 next_steer(void) {
+    steerState ^= steerState << 13;
+    steerState ^= steerState >> 17;
+    steerState ^= steerState << 5;
+    return steerState;
+}
+
+static Point step(Point p, int dir) {
+    switch (dir) {
+        case UP:    p.y -= TILE_SIZE; break;
+        case DOWN:  p.y += TILE_SIZE; break;
+        case LEFT:  p.x -= TILE_SIZE; break;
+        case RIGHT: p.x += TILE_SIZE; break;
+    }
+    p.x = (p.x + SCREEN_WIDTH) % SCREEN_WIDTH;
+    p.y = (p.y + SCREEN_HEIGHT) % SCREEN_HEIGHT;
+    return p;
+}
+
+static int free_around(Point p) {
+    int count = 0;
+    for (int dir = 0; dir < 4; dir++) {
+        count += !is_occupied(step(p, dir));
+    }
+    return count;
+}
+
+// Head for the food while keeping clear of the body, with some noise, and
+// now and then bite on purpose
+static void steer(void) {
+    static const int reverse[4] = { DOWN, UP, RIGHT, LEFT };
+    Point head = snake[snake_head];
+    int bite = next_steer() % 2048 == 0;
+    int bestDir = direction, bestScore = -1000000;
+    for (int dir = 0; dir < 4; dir++) {
+        if (dir == reverse[direction]) continue;
+        Point next = step(head, dir);
+        int score = -(abs(next.x - food.x) + abs(next.y - food.y))
+            + 16*free_around(next) + (int)(next_steer() % 16);
+        if (is_occupied(next) != bite) score -= 100000;
+        if (score > bestScore) {
+            bestScore = score;
+            bestDir = dir;
+        }
+    }
+    direction = bestDir;
+}
+
+static int neighbours(Point a, Point b) {
+    int dx = abs(a.x - b.x), dy = abs(a.y - b.y);
+    return (dx == 0 && (dy == TILE_SIZE || dy == SCREEN_HEIGHT - TILE_SIZE))
+        || (dy == 0 && (dx == TILE_SIZE || dx == SCREEN_WIDTH - TILE_SIZE));
+}
+
+static int check_body(void) {
+    u32 cells[GRID_HEIGHT] = { 0 };
+    for (int i = 0; i < snake_length; i++) {
+        Point p = snake[segment_slot(i)];
+        if (cells[p.y / TILE_SIZE] & cell_bit(p)) return 0;
+        cells[p.y / TILE_SIZE] |= cell_bit(p);
+        if (i && !neighbours(p, snake[segment_slot(i - 1)])) return 0;
+    }
+    return !memcmp(cells, occupied, sizeof cells);
+}
+
+// The free set holds exactly the cells the bitmap leaves clear, each at
+// the place free_slot gives, and the food is on one of them
+static int check_free(void) {
+    if (free_count != MAX_LENGTH - snake_length) return 0;
+    for (int i = 0; i < free_count; i++) {
+        int cell = free_cells[i];
+        Point p = { (cell % GRID_WIDTH) * TILE_SIZE, (cell / GRID_WIDTH) * TILE_SIZE };
+        if (free_slot[cell] != i || is_occupied(p)) return 0;
+    }
+    return !is_occupied(food);
+}
+
+// Every pixel of every cell shows what the state says is there
+static int check_screen(void) {
+    for (int y = 0; y < SCREEN_HEIGHT; y++) {
+        for (int x = 0; x < SCREEN_WIDTH; x++) {
+            Point cell = { x - x % TILE_SIZE, y - y % TILE_SIZE };
+            int tile = cell.x == food.x && cell.y == food.y ? FOOD_TILE
+                : is_occupied(cell) ? SNAKE_TILE : FLOOR_TILE;
+            if (vid_mem[y * SCREEN_WIDTH + x] != tile_colors[tile]) return 0;
+        }
+    }
+    return 1;
+}
+
+// A frame without a move leaves VRAM alone
+static int check_idle_frame(void) {
+    static COLOR before[SCREEN_WIDTH * SCREEN_HEIGHT];
+    memcpy(before, vid_mem, sizeof before);
+    frame_counter = 0;
+    update_snake();
+    return !memcmp(before, vid_mem, sizeof before);
+}
+
+static void check(int ok, const char *what, long at) {
+    if (!ok && failures++ < 5) {
+        printf("FAIL %s at %ld, length %d\n", what, at,
+               snake_length);
+    }
+}
+
+static void random_game(void) {
+    int longest = 0, bites = 0;
+    start_snake();
+    spawn_food();
+    for (long move = 0; move < MOVES && failures < 5; move++) {
+        steer();
+        int before = snake_length;
+        frame_counter = MOVE_DELAY;
+        update_snake();
+
+        check(check_body(), "body and bitmap disagree", move);
+        check(check_free(), "free set and bitmap disagree", move);
+        // Only a bite makes the snake shorter
+        if (snake_length < before) {
+            bites++;
+            check(snake_length <= START_LENGTH, "bite left too long", move);
+        }
+        if (snake_length < before || move % SCREEN_CHECK_MOVES == 0) {
+            check(check_screen(), "screen and state disagree", move);
+            check(check_idle_frame(), "idle frame drew", move);
+        }
+        if (snake_length > longest) longest = snake_length;
+    }
+    printf("random game: longest %d, %d bites\n", longest, bites);
+    check(bites > 0, "walk never bit itself", MOVES);
+    check(longest > START_LENGTH * 4, "walk never grew", MOVES);
+}
+
+// Follow a serpentine that visits every cell, so the snake never bites
+// and grows until its head takes the last free cell, which wins and
+// starts over
+static void board_game(void) {
+    int longest = 0, won = 0;
+    start_snake();
+    spawn_food();
+    direction = RIGHT;
+    for (long move = 0; move < MOVES && failures < 5; move++) {
+        Point head = snake[snake_head];
+        int x = head.x / TILE_SIZE, y = head.y / TILE_SIZE;
+        if (y % 2 == 0) {
+            direction = x < GRID_WIDTH - 1 ? RIGHT : DOWN;
+        } else {
+            direction = x > 0 ? LEFT : DOWN;
+        }
+        int before = snake_length;
+        frame_counter = MOVE_DELAY;
+        update_snake();
+
+        check(check_body(), "body and bitmap disagree", move);
+        check(check_free(), "free set and bitmap disagree", move);
+        if (snake_length > longest) longest = snake_length;
+        if (move % SCREEN_CHECK_MOVES == 0) {
+            check(check_screen(), "screen and state disagree", move);
+        }
+        if (snake_length < before) {
+            won = before == MAX_LENGTH - 1 && snake_length == 1;
+            break;
+        }
+    }
+    printf("board game: longest %d\n", longest);
+    check(won, "snake never covered the board", MOVES);
+}
+
+// Every free cell is picked about equally often, and a taken one never.
+// The counts are binomial, so allow six standard deviations
+static void food_spread(void) {
+    static int picks[MAX_LENGTH];
+    memset(picks, 0, sizeof picks);
+    start_snake();
+    int freeCells = free_count;
+    for (long i = 0; i < (long)freeCells * PICKS_PER_CELL; i++) {
+        spawn_food();
+        picks[cell_index(food)]++;
+    }
+    int fewest = 1 << 30, most = 0;
+    for (int cell = 0; cell < MAX_LENGTH; cell++) {
+        if (free_slot[cell] >= free_count || free_cells[free_slot[cell]] != cell) {
+            check(!picks[cell], "food placed on the snake", cell);
+            continue;
+        }
+        if (picks[cell] < fewest) fewest = picks[cell];
+        if (picks[cell] > most) most = picks[cell];
+    }
+    int spread = 6 * (int)sqrt(PICKS_PER_CELL);
+    printf("food spread: %d to %d picks per cell\n", fewest, most);
+    check(fewest >= PICKS_PER_CELL - spread && most <= PICKS_PER_CELL + spread,
+          "food placement not uniform", 0);
+}
+
+// The same seed plays out the same way
+static void food_seed(void) {
+    Point first[64];
+    rng_state = SNAKE_SEED;
+    start_snake();
+    for (int i = 0; i < 64; i++) {
+        spawn_food();
+        first[i] = food;
+    }
+    rng_state = SNAKE_SEED;
+    start_snake();
+    for (int i = 0; i < 64; i++) {
+        spawn_food();
+        check(food.x == first[i].x && food.y == first[i].y,
+              "seeded food differs", i);
+    }
+}
+
+int main(void) {
+    random_game();
+    board_game();
+    check(check_free(), "free set wrong after a win", 0);
+    check(check_screen(), "screen wrong after a win", 0);
+    food_spread();
+    food_seed();
+
+    if (failures) {
+        printf("%d failures\n", failures);
+        return 1;
+    }
+    printf("snake ok\n");
+    return 0;
+}
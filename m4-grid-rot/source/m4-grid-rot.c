@@ -1,18 +1,20 @@
+#include "bench.h"
+#include "frame.h"
+#include "hud.h"
+#include "map.h"
+#include "math_utils.h"
+#include "prof.h"
+#include "replay.h"
 #include "tonc_input.h"
 #include "tonc_math.h"
 #include "tonc_tte.h"
 #include "tonc_video.h"
 #include <stdlib.h>
 
-
-// Fixed-point math
-enum FixedShiftConsts {
-    FIXED_SHIFT = 12,
-    FIXED_HALF = 1 << (FIXED_SHIFT - 1),
-};
-
-// Convert to Fixed point for macros
-#define INT_TO_FIXED(x) ((int)((x) << FIXED_SHIFT))
+// Build with BENCH set to 1 to run the benchmark scenarios instead of the game
+#ifndef BENCH
+#define BENCH 0
+#endif
 
 enum MathConsts {
     LU_PI = 0x8000,
@@ -28,6 +30,10 @@ enum MapConsts {
     MAP_HEIGHT = 8,
     MAP_X = 80,
     MAP_Y = 40,
+    MAP_PIXEL_WIDTH = MAP_WIDTH*TILE_SIZE,
+    MAP_PIXEL_HEIGHT = MAP_HEIGHT*TILE_SIZE,
+    // 32-bit words per row of the wall bitmap
+    MAP_BITMAP_WORDS = (MAP_PIXEL_WIDTH + 31)/32,
 };
 
 enum ColorConsts {
@@ -38,10 +44,24 @@ enum ColorConsts {
     WALL_COLOR_IDX = 4,
 };
 
+// Debug overlay slots, in the order init_hud() adds them
+enum HudSlots {
+    HUD_PLAYER_X,
+    HUD_PLAYER_Y,
+    HUD_FPS,
+    HUD_THETA,
+    HUD_COS,
+    HUD_SIN,
+    HUD_DIR_X,
+    HUD_DIR_Y,
+};
+
 
 enum PlayerConsts {
     FOV = LU_PI/2,
     RAY_LENGTH = 30,
+    // One ray per column of the raycaster's view of the same FOV
+    RAY_COUNT = 240,
     LINEAR_SPEED = 5,
     ANGULAR_SPEED = LU_PI/3000,
     PLAYER_START_X = INT_TO_FIXED(MAP_X+1*TILE_SIZE) + INT_TO_FIXED(TILE_SIZE/2),
@@ -50,7 +70,7 @@ enum PlayerConsts {
 };
 
 
-static const u16 worldMap[MAP_HEIGHT][MAP_WIDTH] = {
+static const u8 worldTiles[MAP_HEIGHT][MAP_WIDTH] = {
     {1, 1, 1, 1, 1, 1, 1, 1},
     {1, 0, 0, 0, 0, 0, 0, 1},
     {1, 0, 1, 0, 1, 0, 1, 1},
@@ -60,22 +80,8 @@ static const u16 worldMap[MAP_HEIGHT][MAP_WIDTH] = {
     {1, 0, 0, 0, 0, 1, 0, 1},
     {1, 1, 1, 1, 1, 1, 1, 1}
 };
-
-// Convert to Fixed point
-static inline s32 int_to_fixed(s32 x) {
-    return x << FIXED_SHIFT;
-}
-
-// Convert to integer. It adds half the divisor to round up
-static inline s32 fixed_to_int(s32 x) {
-    const s32 half = 1 << (FIXED_SHIFT - 1);
-    if (x >= 0) {
-        return (x + half) >> FIXED_SHIFT;
-    }
-    else {
-        return (x - half) >> FIXED_SHIFT;
-    }
-}
+static u32 worldSolid[MAP_SOLID_WORDS(MAP_WIDTH, MAP_HEIGHT)];
+static Map worldMap;
 
 // Player position
 static u32 playerX = PLAYER_START_X;
@@ -89,76 +95,131 @@ static u32 lastTicks;
 static u32 fps;
 static u16 dt;
 
-static inline u8* back_page(void) {
-    return (u8*)0x06000000
-         + ((REG_DISPCNT & DCNT_PAGE) ? 0x0000 : 0xA000);
+/*
+ * Map tiles the player and the rays were plotted over, per page, one bit
+ * per column in a byte per row. A page is drawn every other frame, so its
+ * bits hold what it showed two frames ago, and only those tiles have to
+ * be repainted before the new fan goes on top. Page 0 is vid_mem_front.
+ */
+static u8 dirtyTiles[2][MAP_HEIGHT];
+
+// Dirty bits of the page being drawn, the one vid_page points at
+static inline u8 *back_dirty_tiles(void) {
+    return dirtyTiles[vid_page == vid_mem_back];
 }
 
-static inline s32 fixed_mul(s32 a, s32 b) {
-    return (s32)(((s64)a * b) >> FIXED_SHIFT);
+static inline void mark_dirty(u8 *dirty, u32 x, u32 y) {
+    dirty[(y-MAP_Y)/TILE_SIZE] |= 1 << ((x-MAP_X)/TILE_SIZE);
 }
 
-
 void draw_tile(u32 x, u32 y, u16 color) {
     m4_rect(x, y, x + TILE_SIZE, y + TILE_SIZE, color);
 }
 
+static inline u16 tile_color(u32 row, u32 col) {
+    return map_solid(&worldMap, col, row) ? WALL_COLOR_IDX : FLOOR_COLOR_IDX;
+}
+
 void draw_map(u32 x, u32 y) {
     for (u16 i = 0; i < MAP_HEIGHT; i++) {
         for (u16 j = 0; j < MAP_WIDTH; j++) {
-            u16 color = FLOOR_COLOR_IDX;
-            if (worldMap[i][j])
-            {
-                color = WALL_COLOR_IDX;
-            }
-            draw_tile(j*TILE_SIZE+x, i*TILE_SIZE+y, color);
+            draw_tile(j*TILE_SIZE+x, i*TILE_SIZE+y, tile_color(i, j));
+        }
+    }
+}
+
+// Repaint the tiles the back page's last fan was drawn over
+void repaint_dirty(u32 x, u32 y) {
+    u8 *dirty = back_dirty_tiles();
+    for (u32 i = 0; i < MAP_HEIGHT; i++) {
+        u32 bits = dirty[i];
+        while (bits) {
+            u32 j = __builtin_ctz(bits);
+            bits &= bits - 1;
+            draw_tile(j*TILE_SIZE+x, i*TILE_SIZE+y, tile_color(i, j));
         }
+        dirty[i] = 0;
     }
 }
 
 void render_player(u32 x, u32 y, u16 color){
+    mark_dirty(back_dirty_tiles(), x, y);
     m4_plot(x, y, color);
 }
 
 
+/*
+ * One bit per screen pixel of the map, set on walls, so a collision test is
+ * a load and a mask instead of a divide into the map. The outer wall is
+ * a tile thick, so nothing that starts inside the map steps out of it.
+ */
+static u32 wallPixels[MAP_PIXEL_HEIGHT][MAP_BITMAP_WORDS];
+
+static void init_wall_pixels(void) {
+    for (u32 y = 0; y < MAP_PIXEL_HEIGHT; y++) {
+        for (u32 x = 0; x < MAP_PIXEL_WIDTH; x++) {
+            if (map_solid(&worldMap, x/TILE_SIZE, y/TILE_SIZE))
+                wallPixels[y][x/32] |= 1u << (x%32);
+        }
+    }
+}
+
 int pixel_in_collision(u32 x, u32 y){
-    int playerXTile = (x-MAP_X)/TILE_SIZE;
-    int playerYTile = (y-MAP_Y)/TILE_SIZE;
-    return worldMap[playerYTile][playerXTile];
+    x -= MAP_X;
+    y -= MAP_Y;
+    return (wallPixels[y][x/32] >> (x%32)) & 1;
+}
+
+
+/*
+ * Bresenham line from (x, y) towards (x + dx, y + dy), without its first
+ * pixel. Stops before the first wall pixel, so a ray ends flush with the
+ * wall it hits.
+ */
+static inline void draw_ray(s32 x, s32 y, s32 dx, s32 dy, u16 color, u8 *dirty) {
+    s32 stepX = dx < 0 ? -1 : 1;
+    s32 stepY = dy < 0 ? -1 : 1;
+    dx = abs(dx);
+    dy = -abs(dy);
+    s32 err = dx + dy;
+    s32 length = dx > -dy ? dx : -dy;
+    for (s32 i = 0; i < length; i++) {
+        s32 err2 = 2*err;
+        if (err2 >= dy) {
+            err += dy;
+            x += stepX;
+        }
+        if (err2 <= dx) {
+            err += dx;
+            y += stepY;
+        }
+        if (pixel_in_collision(x, y))
+            break;
+        mark_dirty(dirty, x, y);
+        m4_plot(x, y, color);
+    }
 }
 
 
 void render_direction(u16 color) {
-    tte_write("#{P:50,105}");
-    tte_erase_line();
-    tte_printf("Player theta: %d", playerTheta);
-    tte_write("#{P:50,115}");
-    tte_erase_line();
+    // The heading within one turn, which is all lu_sin() and lu_cos() use
+    hud_set(HUD_THETA, playerTheta & 0xFFFF);
     u32 x_dir = lu_cos(playerTheta);
     u32 y_dir = lu_sin(playerTheta);
-    tte_printf("Cos Player theta: %d", x_dir);
-    tte_write("#{P:50,125}");
-    tte_erase_line();
-    tte_printf("Sine Player theta: %d", y_dir);
-    tte_write("#{P:50,135}");
-    tte_erase_line();
-    tte_printf("X dir to plot: %d", fixed_to_int(playerX+x_dir));
-    tte_write("#{P:50,145}");
-    tte_erase_line();
-    tte_printf("Y dir to plot: %d", fixed_to_int(playerY+y_dir));
-    for (s32 i = -FOV/2; i < FOV/2+1; i = i + LU_PI/275) {
-        s32 xDir = lu_cos(playerTheta + i);
-        s32 yDir = lu_sin(playerTheta + i);
-        for (u32 j = 1; j < RAY_LENGTH + 1; j++) {
-            // We need to "snap" the position to a tile, which is why these conversions are done
-            u32 xRay = fixed_to_int(int_to_fixed(fixed_to_int(playerX))+j*xDir);
-            u32 yRay = fixed_to_int(int_to_fixed(fixed_to_int(playerY))+j*yDir);
-            if (pixel_in_collision(xRay, yRay))
-            {
-                break;
-            }
-            m4_plot(xRay, yRay, color);
-        }
+    hud_set(HUD_COS, x_dir);
+    hud_set(HUD_SIN, y_dir);
+    hud_set(HUD_DIR_X, fixed_to_int(playerX+x_dir));
+    hud_set(HUD_DIR_Y, fixed_to_int(playerY+y_dir));
+    u8 *dirty = back_dirty_tiles();
+    // Rays start from the player's pixel and end RAY_LENGTH away, rounded
+    // to the nearest pixel
+    s32 x = fixed_to_int(playerX);
+    s32 y = fixed_to_int(playerY);
+    for (u32 i = 0; i < RAY_COUNT; i++) {
+        u32 theta = playerTheta - FOV/2 + i*FOV/(RAY_COUNT - 1);
+        s32 dx = fixed_to_int(RAY_LENGTH*lu_cos(theta));
+        s32 dy = fixed_to_int(RAY_LENGTH*lu_sin(theta));
+        draw_ray(x, y, dx, dy, color, dirty);
     }
 }
 
@@ -184,7 +245,7 @@ static inline s16 clamp_steps(
 
 
 void update_player() {
-    key_poll();
+    replay_key_poll();
 
     s32 moveX = 0, moveY = 0, rotateTheta = 0;
 
@@ -219,16 +280,9 @@ void update_player() {
     s32 safeStepsX = clamp_steps(playerX, deltaX, playerY, false);
     playerX += safeStepsX;
 
-    tte_write("#{P:50,0}");
-    tte_erase_line();
-    tte_printf("Player X: %d", fixed_to_int(playerX));
-    tte_write("#{P:50,10}");
-    tte_erase_line();
-    tte_printf("Player Y: %d", fixed_to_int(playerY));
-    tte_write("#{P:50,105}");
-    tte_write("#{P:50,20}");
-    tte_erase_line();
-    tte_printf("FPS: %d", fps);
+    hud_set(HUD_PLAYER_X, fixed_to_int(playerX));
+    hud_set(HUD_PLAYER_Y, fixed_to_int(playerY));
+    hud_set(HUD_FPS, fps);
 
     render_player(fixed_to_int(playerX), fixed_to_int(playerY), PLAYER_COLOR_IDX);
     render_direction(DIR_COLOR_IDX);
@@ -255,7 +309,7 @@ void init_timebase(void) {
 
 void calc_delta_time(void) {
     u16 now  = REG_TM0CNT_L;
-    dt = now - lastTicks;
+    dt = replay_dt(now - lastTicks);
     lastTicks = now;
 
     /* FPS = frames/seconds = 1/(diff * 1/262144)
@@ -267,11 +321,115 @@ void calc_delta_time(void) {
 }
 
 
+/*
+ * The labels are printed into both pages once, and the values are OBJ
+ * glyphs that only change when the value does. Nothing here is in the
+ * area draw_map() and the rays redraw, so none of it is drawn per frame.
+ * The values are set while a frame is drawn and reach OAM when it is
+ * flipped in.
+ */
+static void init_hud(void) {
+    hud_init(RGB15(31, 31, 31));
+    frame_on_flip(hud_commit);
+    // Widths fit the values' ranges: pixels, FPS up to 5 digits, a heading
+    // of 0 to 65535, and .12 sines and cosines of -4096 to 4096. Every
+    // slot ends inside the screen
+    hud_add(50, 0, "Player X: ", 4);
+    hud_add(50, 10, "Player Y: ", 4);
+    hud_add(50, 20, "FPS: ", 5);
+    hud_add(50, 105, "Player theta: ", 5);
+    hud_add(50, 115, "Cos Player theta: ", 5);
+    hud_add(50, 125, "Sin Player theta: ", 5);
+    hud_add(50, 135, "X dir to plot: ", 4);
+    hud_add(50, 145, "Y dir to plot: ", 4);
+}
+
+
+// The map goes into both pages, after that each frame only repaints the
+// tiles under the player and rays it is about to replace. Always ends
+// with page 1 shown and page 0 drawn next, nothing dirty on either
+static void init_pages(void) {
+    if (REG_DISPCNT & DCNT_PAGE)
+        vid_flip();
+    draw_map(MAP_X, MAP_Y);
+    vid_flip();
+    draw_map(MAP_X, MAP_Y);
+    for (u32 i = 0; i < MAP_HEIGHT; i++) {
+        dirtyTiles[0][i] = 0;
+        dirtyTiles[1][i] = 0;
+    }
+}
+
+
+static void run_frame(void) {
+    frame_wait();
+    calc_delta_time();
+    repaint_dirty(MAP_X, MAP_Y);
+    update_player();
+    frame_submit();
+}
+
+
+#if BENCH
+enum BenchConsts {
+    // 60 fps, in TM0 ticks at /64
+    BENCH_DT = SYSCLK_64/60,
+    // Frames a full turn takes at BENCH_DT
+    BENCH_SPIN_FRAMES = 97,
+};
+
+static const ReplayStep corridorSteps[] = {
+    { 120, KEY_UP, BENCH_DT },
+};
+
+static const ReplayStep openRoomSteps[] = {
+    { 60, KEY_UP | KEY_B, BENCH_DT },
+    { 60, KEY_A, BENCH_DT },
+};
+
+static const ReplayStep wallSteps[] = {
+    { 60, KEY_UP, BENCH_DT },
+};
+
+static const ReplayStep spinSteps[] = {
+    { BENCH_SPIN_FRAMES, KEY_RIGHT, BENCH_DT },
+};
+
+#define TILE_CENTER(origin, t) \
+    INT_TO_FIXED((origin) + (t)*TILE_SIZE + TILE_SIZE/2)
+
+static const BenchScenario benchScenarios[] = {
+    // Along the open top row
+    { "corridor", TILE_CENTER(MAP_X, 1), TILE_CENTER(MAP_Y, 1), 0,
+        corridorSteps, countof(corridorSteps) },
+    // Strafing through the bottom right, where the rays run longest
+    { "open", TILE_CENTER(MAP_X, 3), TILE_CENTER(MAP_Y, 5), 0,
+        openRoomSteps, countof(openRoomSteps) },
+    // Walking into the west wall, every ray stopped short
+    { "wall", TILE_CENTER(MAP_X, 1), TILE_CENTER(MAP_Y, 4), LU_PI,
+        wallSteps, countof(wallSteps) },
+    { "spin", TILE_CENTER(MAP_X, 3), TILE_CENTER(MAP_Y, 5), 0,
+        spinSteps, countof(spinSteps) },
+};
+
+// Every scenario starts from clean pages, whatever ran before it
+static void set_bench_pose(const BenchScenario *scenario) {
+    init_pages();
+    playerX = scenario->x;
+    playerY = scenario->y;
+    playerTheta = scenario->theta;
+}
+#endif
+
+
 int main() {
-    REG_DISPCNT = DCNT_MODE4 | DCNT_BG2;
+    REG_DISPCNT = DCNT_MODE4 | DCNT_BG2 | DCNT_OBJ | DCNT_OBJ_1D;
 
     tte_init_bmp(DCNT_MODE4, NULL, NULL);
     tte_init_con();
+    init_hud();
+    map_init(&worldMap, MAP_WIDTH, MAP_HEIGHT, worldTiles[0], worldSolid);
+    init_wall_pixels();
     init_timebase();
 
     // Set up colors
@@ -286,24 +444,15 @@ int main() {
     // Blue direction
     pal_bg_mem[DIR_COLOR_IDX] = RGB15(0, 0, 31) | BIT(15);
 
-    /* 
-     * Drawing the map here in both screens could make it faster, 
-     * but we would have to constantly erase the player and rays' positions
-     * draw_map(MAP_X, MAP_Y);
-     * vid_flip();
-     * draw_map(MAP_X, MAP_Y);
-    */
+    init_pages();
+#if BENCH
+    prof_init();
+    bench_run("m4-grid-rot", benchScenarios, countof(benchScenarios),
+        set_bench_pose, run_frame);
+#endif
+    frame_init(1);
     while (1) {
-        vid_vsync();
-        calc_delta_time();
-
-        TTC *tc = tte_get_context();
-        tc->dst.data  = back_page();
-        tc->dst.pitch = SCREEN_WIDTH;
-
-        draw_map(MAP_X, MAP_Y);
-        update_player();
-        vid_flip();
+        run_frame();
     }
 }
 
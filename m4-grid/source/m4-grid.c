@@ -1,19 +1,35 @@
+#include "bench.h"
+#include "blit.h"
+#include "frame.h"
+#include "map.h"
+#include "prof.h"
+#include "replay.h"
 #include "tonc_input.h"
 #include "tonc_memdef.h"
 #include <tonc.h>
 
+// Build with BENCH set to 1 to run the benchmark scenarios instead of the game
+#ifndef BENCH
+#define BENCH 0
+#endif
+
+// Build with TILED set to 1 to draw the maze on a mode 0 tiled background
+// and the player as a sprite, instead of plotting both into mode 4 pages
+#ifndef TILED
+#define TILED 0
+#endif
+
 #define SCREEN_WIDTH  240
 #define SCREEN_HEIGHT 160
 #define VRAM ((volatile u16*)0x06000000)
 
-// Fixed-point math
-#define FIXED_SHIFT  8
-#define FIXED(x)     ((int)((x) * (1 << FIXED_SHIFT)))  // Convert to fixed-point (multiply by 256)
-#define FIXED_TO_INT(x) ((x) >> FIXED_SHIFT)  // Extract integer part (divide by 256)
+// Fixed-point math in Q8
+#define FIXED_Q 8
+#include "math_utils.h"
 
 
 // Speed
-const int SPEED = FIXED(0.6);
+const int SPEED = FIXED_CONST(0.6);
 
 // Tile size
 const int TILE_SIZE = 8;
@@ -21,7 +37,7 @@ const int TILE_SIZE = 8;
 // Simple 8×8 maze (1 = wall, 0 = empty space)
 const int MAP_WIDTH = 8;
 const int MAP_HEIGHT = 8;
-const unsigned char worldMap[8][8] = {
+const u8 worldTiles[8][8] = {
     {1, 1, 1, 1, 1, 1, 1, 1},
     {1, 0, 0, 0, 0, 0, 0, 1},
     {1, 0, 1, 0, 1, 0, 1, 1},
@@ -31,48 +47,101 @@ const unsigned char worldMap[8][8] = {
     {1, 0, 0, 0, 0, 1, 0, 1},
     {1, 1, 1, 1, 1, 1, 1, 1}
 };
+u32 worldSolid[MAP_SOLID_WORDS(8, 8)];
+Map worldMap;
 const int MAP_X = 80;
 const int MAP_Y = 40;
 
+#if TILED
+// Tile 0 is left blank, so the rest of the screen shows the backdrop
+const int FLOOR_TILE = 1;
+const int WALL_TILE = 2;
+const int MAP_SBB = 31;
+// The player's OAM entry, copied to oam_mem[0] when a frame is shown
+OBJ_ATTR playerObj;
+#endif
+
 // Player data
 const int PLAYER_SIZE = 4;
 
 // Player position
-const int PLAYER_START_X = FIXED(MAP_X+1*TILE_SIZE) + FIXED(TILE_SIZE/2);
-const int PLAYER_START_Y = FIXED(MAP_Y+6*TILE_SIZE) + FIXED(TILE_SIZE/2);
+const int PLAYER_START_X = INT_TO_FIXED(MAP_X+1*TILE_SIZE) + INT_TO_FIXED(TILE_SIZE/2);
+const int PLAYER_START_Y = INT_TO_FIXED(MAP_Y+6*TILE_SIZE) + INT_TO_FIXED(TILE_SIZE/2);
 int playerX = PLAYER_START_X;
 int playerY = PLAYER_START_Y;
-int playerPrevX = PLAYER_START_X;
-int playerPrevY = PLAYER_START_Y;
 u8 playerColor = 2;
 
-void draw_tile(int x, int y, u8 color) {
-    for (int dy = 0; dy < TILE_SIZE; dy++) {
-        for (int dx = 0; dx < TILE_SIZE; dx++) {
-            m4_plot(x+dy, y+dx, color);
-        }
-    }
-}
+// Player, a solid square in playerColor. Color 0 would be see-through
+const u8 playerSprite[4*4] = {
+    2, 2, 2, 2,
+    2, 2, 2, 2,
+    2, 2, 2, 2,
+    2, 2, 2, 2,
+};
 
+// One screen entry per cell when tiled, x and y must be multiples of TILE_SIZE
 void draw_map(int x, int y) {
     for (int i = 0; i < MAP_HEIGHT; i++) {
+#if TILED
         for (int j = 0; j < MAP_WIDTH; j++) {
-            u8 color = 3;
-            if (worldMap[i][j])
-            {
-                color = 5;
+            se_mem[MAP_SBB][(i + y/TILE_SIZE)*32 + j + x/TILE_SIZE] =
+                map_solid(&worldMap, j, i) ? WALL_TILE : FLOOR_TILE;
+        }
+#else
+        // Runs of one kind of cell. One at least TILE_SIZE cells long, like
+        // a border wall, takes no more calls as a span per pixel row than as
+        // tiles, the rest are tiles. Either way two word stores per cell row
+        for (int j = 0, run; j < MAP_WIDTH; j += run) {
+            bool wall = map_solid(&worldMap, j, i);
+            for (run = 1; j + run < MAP_WIDTH; run++) {
+                if (map_solid(&worldMap, j + run, i) != wall)
+                    break;
+            }
+            int left = j*TILE_SIZE + x;
+            int top = i*TILE_SIZE + y;
+            u8 color = wall ? 5 : 3;
+            if (run < TILE_SIZE) {
+                for (int k = 0; k < run; k++) {
+                    blit_tile(left + k*TILE_SIZE, top, color);
+                }
+                continue;
+            }
+            for (int row = 0; row < TILE_SIZE; row++) {
+                blit_span(left, top + row, run*TILE_SIZE, color);
             }
-            draw_tile(j*TILE_SIZE+x, i*TILE_SIZE+y, color);
         }
+#endif
     }
 }
 
-void render_player(int x, int y, u8 color){
-    for (int i = 0; i < PLAYER_SIZE; i++) {
-        for (int j = 0; j < PLAYER_SIZE; j++) {
-            m4_plot(x+i, y+j, color);
-        }
+#if TILED
+// Solid floor and wall tiles in the colors the bitmap uses, and an 8x8
+// sprite with the player in its top left corner
+void init_tiles() {
+    memset32(&tile_mem[0][FLOOR_TILE], 0x33333333, 8);
+    memset32(&tile_mem[0][WALL_TILE], 0x55555555, 8);
+    memset16(se_mem[MAP_SBB], 0, 32*32);
+    REG_BG0CNT = BG_CBB(0) | BG_SBB(MAP_SBB) | BG_4BPP | BG_REG_32x32;
+
+    u32 *playerTile = tile_mem_obj[0][0].data;
+    for (int row = 0; row < 8; row++) {
+        playerTile[row] = row < PLAYER_SIZE ? 0x00001111 : 0;
     }
+    pal_obj_mem[1] = pal_bg_mem[playerColor];
+    oam_init(oam_mem, 128);
+    obj_set_attr(&playerObj, ATTR0_SQUARE | ATTR0_4BPP, ATTR1_SIZE_8,
+        ATTR2_ID(0));
+}
+
+// Runs where a bitmap frame would be flipped in, so both builds show a
+// move at the same VBlank
+void show_player() {
+    oam_copy(oam_mem, &playerObj, 1);
+}
+#endif
+
+void render_player(int x, int y) {
+    blit_masked(x, y, playerSprite, PLAYER_SIZE, PLAYER_SIZE);
 }
 
 int player_in_collision(int x, int y){
@@ -80,19 +149,19 @@ int player_in_collision(int x, int y){
     int playerXTileRight = (x-MAP_X+(PLAYER_SIZE-1))/TILE_SIZE;
     int playerYTile= (y-MAP_Y)/TILE_SIZE;
     int playerYTileBottom = (y-MAP_Y+(PLAYER_SIZE-1))/TILE_SIZE;
-    return worldMap[playerYTile][playerXTile] ||
-        worldMap[playerYTile][playerXTileRight] ||
-        worldMap[playerYTileBottom][playerXTile] ||
-        worldMap[playerYTileBottom][playerXTileRight];
+    return map_solid(&worldMap, playerXTile, playerYTile) ||
+        map_solid(&worldMap, playerXTileRight, playerYTile) ||
+        map_solid(&worldMap, playerXTile, playerYTileBottom) ||
+        map_solid(&worldMap, playerXTileRight, playerYTileBottom);
 }
 
 
 void update_player() {
-    int prevX = FIXED_TO_INT(playerX);
-    int prevY = FIXED_TO_INT(playerY);
+    int prevX = fixed_floor(playerX);
+    int prevY = fixed_floor(playerY);
     int newX = prevX, newY = prevY;
 
-    key_poll();
+    replay_key_poll();
 
     int moveX = 0, moveY = 0;
 
@@ -102,29 +171,70 @@ void update_player() {
     if (key_is_down(KEY_RIGHT)) moveX = SPEED;
 
     // Apply Y movement first
-    if (!player_in_collision(prevX, FIXED_TO_INT(playerY + moveY))) {
+    if (!player_in_collision(prevX, fixed_floor(playerY + moveY))) {
         playerY += moveY;
-        newY = FIXED_TO_INT(playerY);
+        newY = fixed_floor(playerY);
     }
 
     // Apply X movement after
-    if (!player_in_collision(FIXED_TO_INT(playerX + moveX), newY)) {
+    if (!player_in_collision(fixed_floor(playerX + moveX), newY)) {
         playerX += moveX;
-        newX = FIXED_TO_INT(playerX);
+        newX = fixed_floor(playerX);
     }
 
-    // Erase old position only if moved
-    if (newX != prevX || newY != prevY) {
-        render_player(prevX, prevY, 3);
-    }
+#if TILED
+    // The hardware draws the sprite over the map, nothing to erase
+    obj_set_pos(&playerObj, newX, newY);
+#else
+    // The whole map was just redrawn under it, nothing to erase
+    render_player(newX, newY);
+#endif
+}
 
-    render_player(newX, newY, playerColor);
+
+static void run_frame(void) {
+    frame_wait();
+#if !TILED
+    draw_map(MAP_X, MAP_Y);
+#endif
+    update_player();
+    // Tiled there is no page to flip, show_player() moves the sprite then
+    frame_submit();
 }
 
 
+#if BENCH
+// Movement is a fixed step per frame here, so dt is left at 0
+static const ReplayStep corridorSteps[] = {
+    { 60, KEY_RIGHT, 0 },
+};
+
+static const ReplayStep openRoomSteps[] = {
+    { 30, KEY_RIGHT, 0 },
+    { 30, KEY_UP, 0 },
+    { 30, KEY_LEFT | KEY_DOWN, 0 },
+};
+
+static const ReplayStep wallSteps[] = {
+    { 60, KEY_LEFT, 0 },
+};
+
+// Poses are in map tiles, there is no heading to set
+static const BenchScenario benchScenarios[] = {
+    { "corridor", 1, 1, 0, corridorSteps, countof(corridorSteps) },
+    { "open", 3, 5, 0, openRoomSteps, countof(openRoomSteps) },
+    { "wall", 1, 4, 0, wallSteps, countof(wallSteps) },
+};
+
+static void set_bench_pose(const BenchScenario *scenario) {
+    playerX = INT_TO_FIXED(MAP_X + scenario->x*TILE_SIZE + TILE_SIZE/2);
+    playerY = INT_TO_FIXED(MAP_Y + scenario->y*TILE_SIZE + TILE_SIZE/2);
+}
+#endif
+
 
 int main() {
-    REG_DISPCNT = DCNT_MODE4 | DCNT_BG2;
+    map_init(&worldMap, MAP_WIDTH, MAP_HEIGHT, worldTiles[0], worldSolid);
 
     // Set up colors
     pal_bg_mem[0] = RGB15(0, 0, 0) | BIT(15);   // Black background
@@ -133,11 +243,24 @@ int main() {
     pal_bg_mem[3] = RGB15(16, 0, 0) | BIT(15);  // Red ground
     pal_bg_mem[1] = RGB15(0, 0, 31) | BIT(15);  // Blue alt
 
+#if TILED
+    // The map never changes, so it is written once
+    init_tiles();
+    frame_on_flip(show_player);
+    draw_map(MAP_X, MAP_Y);
+    REG_DISPCNT = DCNT_MODE0 | DCNT_BG0 | DCNT_OBJ | DCNT_OBJ_1D;
+#else
+    REG_DISPCNT = DCNT_MODE4 | DCNT_BG2;
+#endif
+
+#if BENCH
+    prof_init();
+    bench_run(TILED ? "m4-grid-tiled" : "m4-grid", benchScenarios,
+        countof(benchScenarios), set_bench_pose, run_frame);
+#endif
+    frame_init(1);
     while (1) {
-        vid_vsync();
-        draw_map(MAP_X, MAP_Y);
-        update_player();
-        vid_flip();
+        run_frame();
     }
 }
 
@@ -1,4 +0,0 @@
-#ifndef MATH_UTILS_H
-#define MATH_UTILS_H
-
-#endif
@@ -0,0 +1,165 @@
+#ifndef RAYCASTER_H
+#define RAYCASTER_H
+
+#include "map_stream.h"
+#include "math_utils.h"
+#include "tonc_types.h"
+#include "tonc_video.h"
+
+enum MathConsts {
+    LU_PI = 0x8000,
+    // tonc's sin_lut has 512 entries per turn, indexed by the angle >> 7
+    ANGLE_LUT_SHIFT = 7,
+    ANGLE_LUT_SIZE = 512,
+    ANGLE_LUT_QUARTER = ANGLE_LUT_SIZE/4,
+};
+
+enum TimeConsts {
+    SYSCLK_64 = 262144,
+};
+
+enum MapConsts {
+    TILE_SIZE = 8,
+    TILE_SIZE_FIXED = INT_TO_FIXED(8),
+    HALF_TILE_FIXED = TILE_SIZE_FIXED/2,
+    MAP_WIDTH = 9,
+    MAP_HEIGHT = 8,
+};
+
+enum TextureConsts {
+    TEX_SHIFT = 5,
+    TEX_SIZE = 1 << TEX_SHIFT,
+    // Texture rows are stepped in .16 fixed point down a column
+    TEX_V_SHIFT = 16,
+    // Walls are never drawn taller than this, in pixels
+    MAX_WALL_HEIGHT = 1024,
+};
+
+enum SpriteConsts {
+    MAX_SPRITES = 32,
+};
+
+enum ColorConsts {
+    BLACK_COLOR_IDX = 0,
+    DIR_COLOR_IDX = 1,
+    PLAYER_COLOR_IDX = 2,
+    FLOOR_COLOR_IDX = 3,
+};
+
+
+enum PlayerConsts {
+    PLAYER_RADIUS = TILE_SIZE_FIXED/3,
+    FOV = LU_PI/2,
+    RAY_LENGTH = INT_TO_FIXED(100),
+    LINEAR_SPEED = 5,
+    ANGULAR_SPEED = LU_PI/10000,
+    PLAYER_START_X = INT_TO_FIXED(2*TILE_SIZE) + INT_TO_FIXED(TILE_SIZE/2),
+    PLAYER_START_Y = INT_TO_FIXED(5*TILE_SIZE) + INT_TO_FIXED(TILE_SIZE/2),
+    PLAYER_START_THETA = 0,
+};
+
+enum RaySideConsts {
+    // The ray crossed a vertical grid line, so the wall faces east or west
+    RAY_SIDE_EW = 0,
+    // The ray crossed a horizontal grid line, so the wall faces north or south
+    RAY_SIDE_NS = 1,
+    RAY_SIDES = 2,
+};
+
+typedef struct RayHit {
+    // Distance along the ray in fixed point pixels. RAY_LENGTH on a miss
+    s32 dist;
+    // RAY_SIDE_EW or RAY_SIDE_NS
+    u16 side;
+    // Texture column of the hit, [0, TEX_SIZE)
+    u16 texX;
+    // Tile ID of the wall that was hit. 0 on a miss
+    u16 tile;
+} RayHit;
+
+// Rows [top, bottom) of a screen column covered by a wall. Rows above are
+// ceiling and rows below are floor. top <= SCREEN_HEIGHT/2 <= bottom
+typedef struct ColumnSpan {
+    // Texture column drawn on the wall rows, TEX_SIZE texels top to bottom
+    const u8 *texels;
+    // Texture row at top, .16 fixed point
+    u32 texV;
+    // Texture rows per screen row, .16 fixed point
+    u32 texStep;
+    u8 top;
+    u8 bottom;
+} ColumnSpan;
+
+// A billboard standing in the world, always drawn facing the player
+typedef struct Sprite {
+    // Position of its center in fixed point pixels, like the player's
+    s32 x;
+    s32 y;
+    // Index into spriteTextures
+    u16 texture;
+} Sprite;
+
+
+// Streamed through the chunk cache, generated from maps/world.txt
+extern const ChunkedMap worldMap;
+
+// Player position the view is drawn from, interpolated between ticks
+extern u32 playerX;
+extern u32 playerY;
+
+// Player rotation the view is drawn from
+extern u32 playerTheta;
+
+// Sprites in the world, the first spriteCount are drawn
+extern Sprite sprites[MAX_SPRITES];
+extern u32 spriteCount;
+
+// Texture rows per screen row for every wall height, .16 fixed point
+extern u32 texSteps[MAX_WALL_HEIGHT + 1];
+
+/*
+ * Screen height in pixels of a wall, or sprite, dist fixed point pixels
+ * away. This runs for every column, so it divides with the reciprocal
+ * table instead of fixed_div's 64-bit software division. Over every
+ * distance up to RAY_LENGTH the height is within 0.022 pixels (88 LSB) of
+ * the exact divide before rounding, and the rounded height differs by one
+ * pixel for 469 of the 50561 distances.
+ */
+static inline s32 wall_height(s32 dist) {
+    // Cap the height when touching a wall, which also avoids dividing by zero
+    s32 tileDist = dist/TILE_SIZE;
+    if (tileDist < INT_TO_FIXED(SCREEN_HEIGHT)/MAX_WALL_HEIGHT) {
+        tileDist = INT_TO_FIXED(SCREEN_HEIGHT)/MAX_WALL_HEIGHT;
+    }
+    return fixed_to_int(fixed_div_fast(int_to_fixed(SCREEN_HEIGHT), tileDist));
+}
+
+// Fill the per-column ray tables. Call once before rendering
+void init_ray_tables(void);
+
+// Copy the sprite textures to IWRAM. Call once before rendering
+void init_sprite_tables(void);
+
+/*
+ * The functions below run every frame and live in *.iwram.c files, which
+ * are built as ARM code and linked into IWRAM. IWRAM_CODE makes calls from
+ * the Thumb code in ROM use long calls.
+ */
+
+// Cast the rays seen from the player's position. Leaves the back page alone
+IWRAM_CODE void cast_direction(void);
+
+// Draw the walls cast_direction() found, and the sprites, into the back page
+IWRAM_CODE void render_direction(void);
+
+// Write the whole back page from one ColumnSpan per screen column
+IWRAM_CODE void draw_columns(const ColumnSpan *columns);
+
+// Draw the sprites over the walls, hidden where zBuffer is closer
+IWRAM_CODE void draw_sprites(const s32 *zBuffer);
+
+// Where the player circle at (x, y) ends up moving by (dx, dy): it stops at
+// the first wall in the way and slides along it for the rest of the move
+IWRAM_CODE POINT move_player(s32 x, s32 y, s32 dx, s32 dy);
+
+#endif
@@ -0,0 +1,36 @@
+#ifndef TEXTURES_H
+#define TEXTURES_H
+
+#include "raycaster.h"
+
+enum WallTextureConsts {
+    WALL_TEXTURE_COUNT = 3,
+    // Each texture owns 8 light and 8 dark palette entries from here on
+    WALL_PALETTE_START = 16,
+    WALL_PALETTE_SIZE = WALL_TEXTURE_COUNT * 16,
+};
+
+enum SpriteTextureConsts {
+    SPRITE_TEXTURE_COUNT = 2,
+    // Each sprite owns 8 palette entries after the walls'
+    SPRITE_PALETTE_START = WALL_PALETTE_START + WALL_PALETTE_SIZE,
+    SPRITE_PALETTE_SIZE = SPRITE_TEXTURE_COUNT * 8,
+    // Sprite texels with this value are not drawn
+    TRANSPARENT_TEXEL = 0,
+};
+
+/*
+ * Wall texture t is drawn on worldMap cells with the value t + 1. Each one
+ * comes in a light version for east/west faces and a dark one for
+ * north/south faces. They are stored column by column, so the renderer
+ * walks consecutive bytes while it steps down a screen column.
+ * Generated by tools/gen_textures.c.
+ */
+extern const u8 wallTextures[WALL_TEXTURE_COUNT][RAY_SIDES][TEX_SIZE][TEX_SIZE];
+extern const u16 wallPalette[WALL_PALETTE_SIZE];
+
+// Billboard textures, column by column like the walls
+extern const u8 spriteTextures[SPRITE_TEXTURE_COUNT][TEX_SIZE][TEX_SIZE];
+extern const u16 spritePalette[SPRITE_PALETTE_SIZE];
+
+#endif
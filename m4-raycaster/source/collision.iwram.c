@@ -0,0 +1,272 @@
+#include "raycaster.h"
+#include "tonc_math.h"
+
+enum CollisionConsts {
+    // Slides along walls per move. Two walls meeting at a corner need two
+    MAX_SLIDES = 3,
+    // Gap left between the player and a wall it stops at, fixed point
+    // pixels. Wider than the rounding of the corner test
+    CONTACT_SKIN = 32,
+    // Bits dropped before squaring in the corner test, at least. More are
+    // dropped until every term fits in CORNER_BITS, so the squares and
+    // products stay within s64 and the divisor within u32
+    CORNER_SHIFT = 3,
+    CORNER_BITS = 15,
+    // Longest sweep per axis. Longer moves are split into pieces this long,
+    // which keeps a sweep's cells within one map_stream_solid_bits() call
+    MAX_SWEEP = 4*TILE_SIZE_FIXED,
+    // Extra fraction bits of the move's reciprocals. fixed_recip() alone
+    // is too coarse for a contact right at the end of a long move
+    RECIP_EXTRA_SHIFT = 6,
+};
+
+// First contact of the moving player circle with one wall cell
+typedef struct Contact {
+    // Fraction of the move, in [0, FIXED_ONE]. Above that on a miss
+    s32 t;
+    // Where the player's center stops, clear of the wall by CONTACT_SKIN.
+    // Worked out from the wall rather than from t, which is too coarse
+    s32 x;
+    s32 y;
+    // Unit normal of the wall at the contact, pointing out of it
+    s32 normalX;
+    s32 normalY;
+} Contact;
+
+// 1/d with RECIP_EXTRA_SHIFT more fraction bits than fixed point
+static inline s32 move_recip(s32 d) {
+    s32 recip = math_udiv_lut(1, d < 0 ? -d : d,
+        2*FIXED_SHIFT + RECIP_EXTRA_SHIFT);
+    return d < 0 ? -recip : recip;
+}
+
+// Fraction of the move spent covering dist, given move_recip() of the move
+static inline s32 move_time(s32 dist, s32 recip) {
+    s64 t = ((s64)dist*recip) >> (FIXED_SHIFT + RECIP_EXTRA_SHIFT);
+    if (t > MATH_S32_MAX) return MATH_S32_MAX;
+    if (t < MATH_S32_MIN) return MATH_S32_MIN;
+    return t;
+}
+
+/*
+ * Time of impact of a circle moving from (x, y) by (dx, dy) with the corner
+ * (cornerX, cornerY), which is a ray against a circle of the player's
+ * radius around the corner: |p + t d - c|^2 = r^2, taking the first root.
+ * Already inside that circle and moving deeper is a contact at t = 0.
+ */
+static inline void hit_corner(Contact *contact, s32 x, s32 y, s32 dx, s32 dy,
+    s32 cornerX, s32 cornerY)
+{
+    // Grown by half the skin, so a grazing pass that rounding would call a
+    // miss still stops the player
+    s32 grown = PLAYER_RADIUS + CONTACT_SKIN/2;
+    u32 largest = grown;
+    const s32 terms[] = { x - cornerX, y - cornerY, dx, dy };
+    for (u32 i = 0; i < countof(terms); i++) {
+        u32 magnitude = terms[i] < 0 ? 0u - terms[i] : (u32)terms[i];
+        if (magnitude > largest)
+            largest = magnitude;
+    }
+    s32 shift = 32 - __builtin_clz(largest) - CORNER_BITS;
+    if (shift < CORNER_SHIFT)
+        shift = CORNER_SHIFT;
+    s64 fromX = terms[0] >> shift;
+    s64 fromY = terms[1] >> shift;
+    s64 dirX = dx >> shift;
+    s64 dirY = dy >> shift;
+    s64 radius = grown >> shift;
+    s64 a = dirX*dirX + dirY*dirY;
+    s64 b = dirX*fromX + dirY*fromY;
+    s64 c = fromX*fromX + fromY*fromY - radius*radius;
+    // Moving away from the corner, or too short a move to register
+    if (b >= 0 || a == 0)
+        return;
+    s32 t = 0;
+    if (c > 0) {
+        s64 discriminant = b*b - a*c;
+        if (discriminant < 0)
+            return;
+        s64 nearRoot = -b - (s64)math_isqrt64(discriminant);
+        // Contact past the end of the move. Otherwise nearRoot < a, which
+        // is below 2^31 with every term in CORNER_BITS, so t < FIXED_ONE
+        if (nearRoot >= a)
+            return;
+        if (nearRoot > 0)
+            t = math_udiv_lut(nearRoot, a, FIXED_SHIFT);
+    }
+    if (t < 0 || t >= contact->t)
+        return;
+    // The normal is the offset from the corner at the contact, about a
+    // radius long, scaled to unit length
+    s32 offsetX = x + fixed_mul(dx, t) - cornerX;
+    s32 offsetY = y + fixed_mul(dy, t) - cornerY;
+    s32 length = math_isqrt64((s64)offsetX*offsetX + (s64)offsetY*offsetY);
+    if (!length)
+        return;
+    s32 invLength = fixed_recip(length);
+    s32 normalX = fixed_mul(offsetX, invLength);
+    s32 normalY = fixed_mul(offsetY, invLength);
+    contact->t = t;
+    contact->x = cornerX + fixed_mul(normalX, PLAYER_RADIUS + CONTACT_SKIN);
+    contact->y = cornerY + fixed_mul(normalY, PLAYER_RADIUS + CONTACT_SKIN);
+    contact->normalX = normalX;
+    contact->normalY = normalY;
+}
+
+/*
+ * The circle touches the cell when its center is inside the cell grown by
+ * the radius with rounded corners. Sweep the center against the grown box
+ * with slabs; where it enters beside a face this is the contact, otherwise
+ * it enters at a rounded corner and hit_corner() decides. Reciprocals of
+ * the move are passed in so no division is needed per cell.
+ */
+static inline void hit_cell(Contact *contact, s32 x, s32 y, s32 dx, s32 dy,
+    s32 invX, s32 invY, s32 cellX, s32 cellY)
+{
+    s32 left = int_to_fixed(cellX*TILE_SIZE);
+    s32 top = int_to_fixed(cellY*TILE_SIZE);
+    s32 right = left + TILE_SIZE_FIXED;
+    s32 bottom = top + TILE_SIZE_FIXED;
+
+    s32 enterX, exitX, enterY, exitY;
+    if (dx) {
+        s32 nearX = dx > 0 ? left - PLAYER_RADIUS : right + PLAYER_RADIUS;
+        s32 farX = dx > 0 ? right + PLAYER_RADIUS : left - PLAYER_RADIUS;
+        enterX = move_time(nearX - x, invX);
+        exitX = move_time(farX - x, invX);
+    }
+    else if (x > left - PLAYER_RADIUS && x < right + PLAYER_RADIUS) {
+        enterX = MATH_S32_MIN;
+        exitX = MATH_S32_MAX;
+    }
+    else return;
+    if (dy) {
+        s32 nearY = dy > 0 ? top - PLAYER_RADIUS : bottom + PLAYER_RADIUS;
+        s32 farY = dy > 0 ? bottom + PLAYER_RADIUS : top - PLAYER_RADIUS;
+        enterY = move_time(nearY - y, invY);
+        exitY = move_time(farY - y, invY);
+    }
+    else if (y > top - PLAYER_RADIUS && y < bottom + PLAYER_RADIUS) {
+        enterY = MATH_S32_MIN;
+        exitY = MATH_S32_MAX;
+    }
+    else return;
+
+    bool enterOnX = enterX > enterY;
+    s32 enter = enterOnX ? enterX : enterY;
+    s32 exit = exitX < exitY ? exitX : exitY;
+    if (enter > exit || enter >= contact->t || exit <= 0)
+        return;
+    // Starting inside the grown box is fine in its corners, left to
+    // hit_corner(). Elsewhere it overlaps a face: pushed back out when the
+    // center is still in front of the face, let out when it is past it
+    s32 t = enter > 0 ? enter : 0;
+
+    // Where the center crosses the face, along the face
+    if (enterOnX) {
+        s32 along = y + fixed_mul(dy, t);
+        if (along < top || along > bottom) {
+            // Where the face goes on into the next wall it has no corner
+            if (!map_stream_solid(cellX, along < top ? cellY - 1 : cellY + 1))
+                hit_corner(contact, x, y, dx, dy, dx > 0 ? left : right,
+                    along < top ? top : bottom);
+            return;
+        }
+        if (enter < 0 && (dx > 0 ? x > left : x < right))
+            return;
+        contact->normalX = dx > 0 ? -FIXED_ONE : FIXED_ONE;
+        contact->normalY = 0;
+        contact->x = dx > 0 ? left - PLAYER_RADIUS - CONTACT_SKIN
+            : right + PLAYER_RADIUS + CONTACT_SKIN;
+        contact->y = along;
+    }
+    else {
+        s32 along = x + fixed_mul(dx, t);
+        if (along < left || along > right) {
+            if (!map_stream_solid(along < left ? cellX - 1 : cellX + 1, cellY))
+                hit_corner(contact, x, y, dx, dy, along < left ? left : right,
+                    dy > 0 ? top : bottom);
+            return;
+        }
+        if (enter < 0 && (dy > 0 ? y > top : y < bottom))
+            return;
+        contact->normalX = 0;
+        contact->normalY = dy > 0 ? -FIXED_ONE : FIXED_ONE;
+        contact->x = along;
+        contact->y = dy > 0 ? top - PLAYER_RADIUS - CONTACT_SKIN
+            : bottom + PLAYER_RADIUS + CONTACT_SKIN;
+    }
+    contact->t = t;
+}
+
+// Earliest contact with any wall cell the move's bounding box touches
+static inline Contact first_contact(s32 x, s32 y, s32 dx, s32 dy) {
+    Contact contact = { FIXED_ONE + 1, 0, 0, 0, 0 };
+    s32 invX = dx ? move_recip(dx) : 0;
+    s32 invY = dy ? move_recip(dy) : 0;
+    s32 minX = (dx < 0 ? x + dx : x) - PLAYER_RADIUS;
+    s32 maxX = (dx > 0 ? x + dx : x) + PLAYER_RADIUS;
+    s32 minY = (dy < 0 ? y + dy : y) - PLAYER_RADIUS;
+    s32 maxY = (dy > 0 ? y + dy : y) + PLAYER_RADIUS;
+    s32 firstCellX = fixed_floor(minX)/TILE_SIZE;
+    s32 lastCellX = fixed_floor(maxX)/TILE_SIZE;
+    s32 firstCellY = fixed_floor(minY)/TILE_SIZE;
+    s32 lastCellY = fixed_floor(maxY)/TILE_SIZE;
+    for (s32 cellY = firstCellY; cellY <= lastCellY; cellY++) {
+        // The row's cells at once, only walls are tested
+        u32 walls = map_stream_solid_bits(firstCellX, cellY,
+            lastCellX - firstCellX + 1);
+        while (walls) {
+            s32 cellX = firstCellX + __builtin_ctz(walls);
+            walls &= walls - 1;
+            hit_cell(&contact, x, y, dx, dy, invX, invY, cellX, cellY);
+        }
+    }
+    return contact;
+}
+
+// Move by at most MAX_SWEEP per axis, sliding along what it hits
+static inline POINT sweep(s32 x, s32 y, s32 dx, s32 dy) {
+    for (u32 slide = 0; slide < MAX_SLIDES && (dx || dy); slide++) {
+        Contact contact = first_contact(x, y, dx, dy);
+        if (contact.t > FIXED_ONE) {
+            x += dx;
+            y += dy;
+            break;
+        }
+        // Up to the wall, then what is left of the move along it
+        x = contact.x;
+        y = contact.y;
+        dx -= fixed_mul(dx, contact.t);
+        dy -= fixed_mul(dy, contact.t);
+        s32 into = fixed_mul(dx, contact.normalX) + fixed_mul(dy, contact.normalY);
+        if (into < 0) {
+            dx -= fixed_mul(into, contact.normalX);
+            dy -= fixed_mul(into, contact.normalY);
+        }
+    }
+    POINT position = { x, y };
+    return position;
+}
+
+IWRAM_CODE POINT move_player(s32 x, s32 y, s32 dx, s32 dy) {
+    u32 absX = dx < 0 ? 0u - dx : (u32)dx;
+    u32 absY = dy < 0 ? 0u - dy : (u32)dy;
+    u32 longest = absX > absY ? absX : absY;
+    POINT position = { x, y };
+    if (!longest)
+        return position;
+    u32 pieces = 1 + (longest - 1)/MAX_SWEEP;
+    // A division per move, but only moves longer than MAX_SWEEP take it
+    for (u32 i = 0; i < pieces; i++) {
+        s32 pieceX = pieces == 1 ? dx : dx/(s32)pieces;
+        s32 pieceY = pieces == 1 ? dy : dy/(s32)pieces;
+        // The last piece takes what the rounding left over
+        if (i == pieces - 1) {
+            pieceX = dx - pieceX*(s32)(pieces - 1);
+            pieceY = dy - pieceY*(s32)(pieces - 1);
+        }
+        position = sweep(position.x, position.y, pieceX, pieceY);
+    }
+    return position;
+}
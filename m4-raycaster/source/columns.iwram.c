@@ -0,0 +1,160 @@
+#include "prof.h"
+#include "raycaster.h"
+#include "tonc_bios.h"
+#include "tonc_video.h"
+
+/*
+ * How ceiling and floor get written:
+ * 0: clear the ceiling and floor halves of the page with CpuFastSet, then
+ *    write only the wall rows of each column pair
+ * 1: write every halfword exactly once, the ceiling and floor rows above
+ *    and below each column pair included
+ * Compare both with the cycle count shown while SELECT is held. 1 stays
+ * the default until the fills measure faster on hardware.
+ */
+#ifndef RAY_CLEAR_SPANS
+#define RAY_CLEAR_SPANS 1
+#endif
+
+enum ColumnConsts {
+    // Halfwords per mode 4 line
+    PAIR_PITCH = SCREEN_WIDTH/2,
+    // Words in the ceiling or floor half of a mode 4 page
+    HALF_PAGE_WORDS = SCREEN_WIDTH*SCREEN_HEIGHT/2/4,
+};
+
+// Two adjacent mode 4 pixels as stored in one VRAM halfword
+static inline u16 pixel_pair(u8 left, u8 right) {
+    return left | (right << 8);
+}
+
+// Write pixels down a column pair for count rows. Returns where it stopped
+static inline u16 *fill_pair(u16 *dst, u32 count, u16 pixels) {
+    while (count--) {
+        *dst = pixels;
+        dst += PAIR_PITCH;
+    }
+    return dst;
+}
+
+// Walks a texture column down the screen
+typedef struct TexelStepper {
+    const u8 *texels;
+    u32 v;
+    u32 step;
+} TexelStepper;
+
+/*
+ * Ceiling and floor stepped like a texture that never advances. That way
+ * every run of a column pair, whether it is wall on one side or both, goes
+ * through the same loop.
+ */
+static const u8 ceilingTexel = BLACK_COLOR_IDX;
+static const u8 floorTexel = FLOOR_COLOR_IDX;
+
+// Write count rows down a column pair from two texture steppers
+static inline u16 *texture_pair(u16 *dst, u32 count,
+    TexelStepper *left,
+    TexelStepper *right)
+{
+    const u8 *leftTexels = left->texels;
+    const u8 *rightTexels = right->texels;
+    u32 leftV = left->v, leftStep = left->step;
+    u32 rightV = right->v, rightStep = right->step;
+    while (count--) {
+        *dst = pixel_pair(leftTexels[leftV >> TEX_V_SHIFT],
+            rightTexels[rightV >> TEX_V_SHIFT]);
+        dst += PAIR_PITCH;
+        leftV += leftStep;
+        rightV += rightStep;
+    }
+    left->v = leftV;
+    right->v = rightV;
+    return dst;
+}
+
+/*
+ * Mode 4 VRAM can only be written 16 bits at a time, so drawing one column
+ * means a read-modify-write of every halfword it touches. Instead walk the
+ * screen one pair of columns at a time and write each halfword once.
+ *
+ * Because every span straddles the middle of the screen, the wall rows of a
+ * pair split into at most three runs: one wall and one ceiling, both wall,
+ * one wall and one floor. dst points at the row of the higher top. Returns
+ * the row below the lower bottom.
+ */
+static inline u16 *draw_pair_walls(u16 *dst,
+    const ColumnSpan *left,
+    const ColumnSpan *right)
+{
+    TexelStepper leftWall = { left->texels, left->texV, left->texStep };
+    TexelStepper rightWall = { right->texels, right->texV, right->texStep };
+    TexelStepper ceiling = { &ceilingTexel, 0, 0 };
+    TexelStepper floor = { &floorTexel, 0, 0 };
+    u32 wallTop;
+    if (left->top <= right->top) {
+        wallTop = right->top;
+        dst = texture_pair(dst, right->top - left->top, &leftWall, &ceiling);
+    }
+    else {
+        wallTop = left->top;
+        dst = texture_pair(dst, left->top - right->top, &ceiling, &rightWall);
+    }
+    if (left->bottom <= right->bottom) {
+        dst = texture_pair(dst, left->bottom - wallTop, &leftWall, &rightWall);
+        dst = texture_pair(dst, right->bottom - left->bottom, &floor, &rightWall);
+    }
+    else {
+        dst = texture_pair(dst, right->bottom - wallTop, &leftWall, &rightWall);
+        dst = texture_pair(dst, left->bottom - right->bottom, &leftWall, &floor);
+    }
+    return dst;
+}
+
+#if RAY_CLEAR_SPANS
+IWRAM_CODE void draw_columns(const ColumnSpan *columns) {
+    PROF_BEGIN("draw");
+    u16 *dst = (u16*)vid_page;
+    for (u32 x = 0; x < SCREEN_WIDTH; x += 2, dst++) {
+        const ColumnSpan *left = &columns[x];
+        const ColumnSpan *right = &columns[x + 1];
+        u32 top = left->top < right->top ? left->top : right->top;
+        u32 bottom = left->bottom > right->bottom ? left->bottom : right->bottom;
+        u16 *pixels = fill_pair(dst, top,
+            pixel_pair(BLACK_COLOR_IDX, BLACK_COLOR_IDX));
+        pixels = draw_pair_walls(pixels, left, right);
+        fill_pair(pixels, SCREEN_HEIGHT - bottom,
+            pixel_pair(FLOOR_COLOR_IDX, FLOOR_COLOR_IDX));
+    }
+    PROF_END;
+}
+#else
+// Four ceiling and four floor pixels, the source words of the CpuFastSet fills
+static const u32 backgroundFills[2] = {
+    BLACK_COLOR_IDX * 0x01010101,
+    FLOOR_COLOR_IDX * 0x01010101,
+};
+
+/*
+ * CpuFastSet fills with 8-word stores, which costs about a third of walking
+ * the same rows one halfword at a time. Rewriting the wall rows afterwards
+ * is cheaper than writing ceiling and floor per column unless the walls
+ * cover most of the screen.
+ */
+IWRAM_CODE void draw_columns(const ColumnSpan *columns) {
+    u16 *dst = (u16*)vid_page;
+    PROF_BEGIN("clear");
+    CpuFastSet(&backgroundFills[0], dst, CS_FILL | HALF_PAGE_WORDS);
+    CpuFastSet(&backgroundFills[1], dst + SCREEN_HEIGHT/2*PAIR_PITCH,
+        CS_FILL | HALF_PAGE_WORDS);
+    PROF_END;
+    PROF_BEGIN("draw");
+    for (u32 x = 0; x < SCREEN_WIDTH; x += 2, dst++) {
+        const ColumnSpan *left = &columns[x];
+        const ColumnSpan *right = &columns[x + 1];
+        u32 top = left->top < right->top ? left->top : right->top;
+        draw_pair_walls(dst + top*PAIR_PITCH, left, right);
+    }
+    PROF_END;
+}
+#endif
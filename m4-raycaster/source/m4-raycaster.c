@@ -1,301 +1,96 @@
+#include "bench.h"
+#include "frame.h"
+#include "prof.h"
+#include "raycaster.h"
+#include "replay.h"
+#include "textures.h"
+#include "tick.h"
+#include "tonc_core.h"
 #include "tonc_input.h"
 #include "tonc_math.h"
 #include "tonc_tte.h"
 #include "tonc_video.h"
 #include <math.h>
 
-
-// Fixed-point math
-enum FixedShiftConsts {
-    FIXED_SHIFT = 12,
-    FIXED_HALF = 1 << (FIXED_SHIFT - 1),
-};
-
-// Convert to Fixed point for macros
-#define INT_TO_FIXED(x) ((int)((x) << FIXED_SHIFT))
-
-enum MathConsts {
-    LU_PI = 0x8000,
-};
-
-enum TimeConsts {
-    SYSCLK_64 = 262144,
+// Build with BENCH set to 1 to run the benchmark scenarios instead of the game
+#ifndef BENCH
+#define BENCH 0
+#endif
+
+// Sprite placed at the center of each tile, spriteTextures index + 1
+static const u8 spriteMap[MAP_HEIGHT][MAP_WIDTH] = {
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 1, 2, 2, 2, 2, 2, 1, 0},
+    {0, 2, 2, 0, 0, 0, 2, 2, 0},
+    {0, 2, 2, 0, 1, 2, 2, 0, 0},
+    {0, 2, 2, 0, 2, 2, 2, 0, 0},
+    {0, 2, 0, 2, 2, 0, 2, 2, 0},
+    {0, 1, 2, 2, 2, 0, 2, 1, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0}
 };
 
-enum MapConsts {
-    TILE_SIZE = 8,
-    TILE_SIZE_FIXED = INT_TO_FIXED(8),
-    HALF_TILE_FIXED = TILE_SIZE_FIXED/2,
-    MAP_WIDTH = 9,
-    MAP_HEIGHT = 9,
-};
 
-enum ColorConsts {
-    BLACK_COLOR_IDX = 0,
-    DIR_COLOR_IDX = 1,
-    PLAYER_COLOR_IDX = 2,
-    FLOOR_COLOR_IDX = 3,
-    LIGHT_WALL_COLOR_IDX = 4,
-    DARK_WALL_COLOR_IDX = 5,
+enum SimConsts {
+    // Length of a simulation tick, in fixed point seconds
+    TICK_SECONDS = INT_TO_FIXED(TICK_DT)/SYSCLK_64,
+    // How far the player moves and turns per tick
+    LINEAR_MOVE = LINEAR_SPEED*TICK_SECONDS,
+    ANGULAR_MOVE = ANGULAR_SPEED*TICK_SECONDS,
+    // VBlanks per drawn frame. 2 draws at 30 Hz, the simulation still runs
+    // at TICK_HZ
+    FRAME_VBLANKS = 1,
+    // Row of the late and dropped frame counts under the stage timings
+    FRAME_STATS_Y = SCREEN_HEIGHT - 10,
 };
 
+typedef struct PlayerState {
+    s32 x;
+    s32 y;
+    u32 theta;
+} PlayerState;
 
-enum PlayerConsts {
-    PLAYER_RADIUS = TILE_SIZE_FIXED/3,
-    PLAYER_RADIUS_SQUARED = (PLAYER_RADIUS * PLAYER_RADIUS) >> FIXED_SHIFT,
-    FOV = LU_PI/2,
-    RAY_LENGTH = INT_TO_FIXED(100),
-    LINEAR_SPEED = 5,
-    ANGULAR_SPEED = LU_PI/10000,
-    PLAYER_START_X = INT_TO_FIXED(2*TILE_SIZE) + INT_TO_FIXED(TILE_SIZE/2),
-    PLAYER_START_Y = INT_TO_FIXED(5*TILE_SIZE) + INT_TO_FIXED(TILE_SIZE/2),
-    PLAYER_START_THETA = 0,
+// Simulated player after the last tick and the one before it
+static PlayerState player = {
+    PLAYER_START_X, PLAYER_START_Y, PLAYER_START_THETA
 };
-
-
-static const u16 worldMap[MAP_HEIGHT][MAP_WIDTH] = {
-    {1, 1, 1, 1, 1, 1, 1, 1, 1},
-    {1, 0, 0, 0, 0, 0, 0, 0, 1},
-    {1, 0, 0, 1, 1, 1, 0, 0, 1},
-    {1, 0, 0, 1, 0, 0, 0, 1, 1},
-    {1, 0, 0, 1, 0, 0, 0, 1, 1},
-    {1, 0, 0, 0, 0, 1, 0, 0, 1},
-    {1, 0, 0, 0, 0, 1, 0, 0, 1},
-    {1, 1, 1, 1, 1, 1, 1, 1, 1}
+static PlayerState lastPlayer = {
+    PLAYER_START_X, PLAYER_START_Y, PLAYER_START_THETA
 };
 
-// Convert to Fixed point
-static inline s32 int_to_fixed(s32 x) {
-    return x << FIXED_SHIFT;
-}
-
-// Convert to integer. It adds half the divisor to round up
-static inline s32 fixed_to_int_s(s32 x) {
-    const s32 half = 1 << (FIXED_SHIFT - 1);
-    if (x >= 0) {
-        return (x + half) >> FIXED_SHIFT;
-    }
-    else {
-        return (x - half) >> FIXED_SHIFT;
-    }
-}
-
-static inline u32 fixed_to_int_u(u32 x) {
-    const u32 half = 1u << (FIXED_SHIFT - 1);
-    return (x + half) >> FIXED_SHIFT;
-}
-
-#define fixed_to_int(x) _Generic((x), \
-s32: fixed_to_int_s,    \
-u32: fixed_to_int_u,   \
-default: fixed_to_int_s \
-)(x)
-
+// Player position the view is drawn from, between the last two ticks
+u32 playerX = PLAYER_START_X;
+u32 playerY = PLAYER_START_Y;
 
-// Player position
-static u32 playerX = PLAYER_START_X;
-static u32 playerY = PLAYER_START_Y;
+// Player rotation the view is drawn from
+u32 playerTheta = PLAYER_START_THETA;
 
-// Player rotation
-static u32 playerTheta = PLAYER_START_THETA;
+// Sprites
+Sprite sprites[MAX_SPRITES];
+u32 spriteCount;
 
 // Time
 static u32 lastTicks;
-static u32 fps;
 static u16 dt;
 
+// vid_page is always the page that is not being displayed
 static inline u8* back_page(void) {
-    return (u8*)0x06000000
-         + ((REG_DISPCNT & DCNT_PAGE) ? 0x0000 : 0xA000);
-}
-
-static inline s32 fixed_mul(s32 a, s32 b) {
-    return (s32)(((s64)a * b) >> FIXED_SHIFT);
-}
-
-static inline s32 fixed_div(s32 a, s32 b) {
-    return (s32)(((s64)a << FIXED_SHIFT) / b);
-}
-
-static inline u32 fixed_abs(s32 x) {
-    return x < 0 ? -x : x;
-}
-
-
-static inline u32 pixel_in_collision(u32 x, u32 y){
-    u32 playerTileX = x/TILE_SIZE;
-    u32 playerTileY = y/TILE_SIZE;
-    return worldMap[playerTileY][playerTileX];
-}
-
-static inline POINT player_in_collision(s32 playerCenterX, s32 playerCenterY){
-    s32 playerTileX = fixed_to_int(playerCenterX)/TILE_SIZE;
-    s32 playerTileY = fixed_to_int(playerCenterY)/TILE_SIZE;
-    POINT moveCoords = { 0, 0 };
-    for (s32 i = -1; i < 2; i++) {
-        for (s32 j = -1; j < 2; j++) {
-            s32 neighborTileX = playerTileX + j;
-            s32 neighborTileY = playerTileY + i;
-            // Do not check out of bounds
-            if (neighborTileX < 0 || neighborTileX >= MAP_WIDTH ||
-                    neighborTileY < 0 || neighborTileY >= MAP_HEIGHT)
-                continue;
-            // Do not check for collisions if this is not a wall
-            if (!worldMap[neighborTileY][neighborTileX]) {
-                continue;
-            }
-            // Get the fixed coords for the AABB to check against
-            s32 neighborX = int_to_fixed(neighborTileX * TILE_SIZE);
-            s32 neighborY = int_to_fixed(neighborTileY * TILE_SIZE);
-            s32 neighborCenterX = neighborX + HALF_TILE_FIXED;
-            s32 neighborCenterY = neighborY + HALF_TILE_FIXED;
-            s32 differenceX = playerCenterX - neighborCenterX;
-            s32 differenceY = playerCenterY - neighborCenterY;
-            s32 clampX = clamp(differenceX, -HALF_TILE_FIXED, HALF_TILE_FIXED);
-            s32 clampY = clamp(differenceY, -HALF_TILE_FIXED, HALF_TILE_FIXED);
-            s32 closestX = neighborCenterX + clampX;
-            s32 closestY = neighborCenterY + clampY;
-            s32 distanceX = closestX - playerCenterX;
-            s32 distanceY = closestY - playerCenterY;
-            s32 distanceSquared = fixed_mul(distanceX, distanceX) + fixed_mul(distanceY, distanceY);
-            if (distanceSquared < PLAYER_RADIUS_SQUARED) {
-                s32 penetrationX = PLAYER_RADIUS - fixed_abs(distanceX);
-                s32 penetrationY = PLAYER_RADIUS - fixed_abs(distanceY);
-                s32 moveX = penetrationX;
-                s32 moveY = penetrationY;
-                if (distanceX > 0) {
-                    moveX = -moveX;
-                }
-                if (distanceY > 0) {
-                    moveY = -moveY;
-                }
-                moveCoords.x += moveX;
-                moveCoords.y += moveY;
-            }
-        }
-    }
-    return moveCoords;
-}
-
-static inline void render_direction() {
-    m4_fill(BLACK_COLOR_IDX);
-    m4_rect(0, SCREEN_HEIGHT/2, SCREEN_WIDTH, SCREEN_HEIGHT, FLOOR_COLOR_IDX);
-    /*
-    s32 here = 0;
-    s32 rayAngle = playerTheta - FOV/2 + fixed_mul((int_to_fixed(200)/SCREEN_WIDTH), FOV);
-    s32 xDir = lu_cos(rayAngle);
-    s32 yDir = lu_sin(rayAngle);
-    for (u32 j = 1; j < RAY_LENGTH + 1; j = j + 1) {
-        u32 z = int_to_fixed(j);
-        u32 xRay = playerX+fixed_mul(z, xDir);
-        u32 yRay = playerY+fixed_mul(z, yDir);
-        if (pixel_in_collision(fixed_to_int(xRay), fixed_to_int(yRay))) {
-            dist = int_to_fixed(j - 1);
-            break;
-        }
-    }
-    s32 xDist = fixed_mul(dist, xDir);
-    s32 yDist = fixed_mul(dist, yDir);
-    for (u32 j = 1; j < RAY_LENGTH + 1; j = j + 300) {
-        u32 xRay = playerX + xDist + fixed_mul(j, xDir);
-        u32 yRay = playerY + yDist + fixed_mul(j, yDir);
-        here++;
-        if (pixel_in_collision(fixed_to_int(xRay), fixed_to_int(yRay))) {
-            dist += j;
-            break;
-        }
-    }
-    s32 height = SCREEN_HEIGHT/fixed_to_int(dist);
-    tte_write("#{P:50,115}");
-    tte_erase_line();
-    tte_printf("test: %d", height);
-    tte_write("#{P:50,125}");
-    tte_erase_line();
-    tte_printf("cnt: %d", here);
-    tte_write("#{P:50,135}");
-    tte_erase_line();
-    tte_printf("Player X: %d", playerX);
-    tte_write("#{P:50,145}");
-    tte_erase_line();
-    tte_printf("dist: %d", dist);
-    */
-    for (s16 i = 0; i < SCREEN_WIDTH; i++ ) {
-        s32 dist = RAY_LENGTH;
-        s32 rayAngle = playerTheta - FOV/2 + fixed_mul((int_to_fixed(i)/SCREEN_WIDTH), FOV);
-        s32 xDir = lu_cos(rayAngle);
-        s32 yDir = lu_sin(rayAngle);
-        for (u32 j = 1; j < RAY_LENGTH + 1; j = j + 1) {
-            u32 z = int_to_fixed(j);
-            u32 xRay = playerX+fixed_mul(z, xDir);
-            u32 yRay = playerY+fixed_mul(z, yDir);
-            if (pixel_in_collision(fixed_to_int(xRay), fixed_to_int(yRay))) {
-                dist = int_to_fixed(j - 1);
-                break;
-            }
-        }
-        s32 xDist = fixed_mul(dist, xDir);
-        s32 yDist = fixed_mul(dist, yDir);
-        for (u32 j = 1; j < RAY_LENGTH + 1; j = j + 300) {
-            u32 xRay = playerX + xDist + fixed_mul(j, xDir);
-            u32 yRay = playerY + yDist + fixed_mul(j, yDir);
-            if (pixel_in_collision(fixed_to_int(xRay), fixed_to_int(yRay))) {
-                dist += j;
-                break;
-            }
-        }
-        // Fish-eye correction
-        dist = fixed_mul(dist, lu_cos(rayAngle - playerTheta));
-        // If wall within range
-        s32 lineHeight = fixed_div(int_to_fixed(SCREEN_HEIGHT), dist/TILE_SIZE);
-        if (lineHeight > int_to_fixed(SCREEN_HEIGHT)) {
-            lineHeight = int_to_fixed(SCREEN_HEIGHT);
-        }
-        s32 offset = int_to_fixed(SCREEN_HEIGHT)/2 - lineHeight/2;
-        if (offset < 0) {
-            offset = 0;
-        }
-        // Draw walls
-        u16 wallColor = LIGHT_WALL_COLOR_IDX;
-        if (dist < RAY_LENGTH) {
-            m4_rect(i, fixed_to_int(offset), i + 1, fixed_to_int(offset + lineHeight), wallColor);
-        }
-    }
+    return (u8*)vid_page;
 }
 
-static inline s16 clamp_steps(
-    u32 currentAxisCoord,
-    s32 delta,
-    u32 otherAxisCoord,
-    bool isVertical
-    ) 
-{
-    if (delta == 0) return 0;
-    s32  sign  = (delta > 0) ?  1 : -1;
-    u32  steps = fixed_abs(delta);
-    for (u16 i = 1; i <= steps; i = i + TILE_SIZE) {
-        u32 x = isVertical ? otherAxisCoord : currentAxisCoord + sign * i;
-        u32 y = isVertical ? currentAxisCoord + sign * i : otherAxisCoord;
-        POINT moveCoords = player_in_collision(x, y);
-        if (moveCoords.x != 0 || moveCoords.y != 0)
-            return sign * (i - TILE_SIZE);
-    }
-    return sign * steps;
-}
-
-static inline void update_player() {
-    key_poll();
+// Advance the player by one tick, with the keys read this frame.
+// Catch-up ticks run back to back, so every tick of a frame sees the same
+// keys; per-tick input would need the keypad sampled from an interrupt.
+static inline void simulate_tick(void) {
+    lastPlayer = player;
 
+    PROF_BEGIN("input");
     s16 moveX = 0, moveY = 0, rotateTheta = 0;
-
-    s16 secPerFrame = int_to_fixed(dt) / SYSCLK_64;
-    s16 linearMove = LINEAR_SPEED * secPerFrame;
-    s16 angularMove = ANGULAR_SPEED * secPerFrame;
-    if (key_is_down(KEY_UP)) moveY += linearMove;
-    if (key_is_down(KEY_DOWN)) moveY += -linearMove;
-    if (key_is_down(KEY_R)) moveX += -linearMove;
-    if (key_is_down(KEY_L)) moveX += linearMove;
-    if (key_is_down(KEY_LEFT)) rotateTheta += -angularMove;
-    if (key_is_down(KEY_RIGHT)) rotateTheta += angularMove;
+    if (key_is_down(KEY_UP)) moveY += LINEAR_MOVE;
+    if (key_is_down(KEY_DOWN)) moveY += -LINEAR_MOVE;
+    if (key_is_down(KEY_R)) moveX += -LINEAR_MOVE;
+    if (key_is_down(KEY_L)) moveX += LINEAR_MOVE;
+    if (key_is_down(KEY_LEFT)) rotateTheta += -ANGULAR_MOVE;
+    if (key_is_down(KEY_RIGHT)) rotateTheta += ANGULAR_MOVE;
     // Handle moving diagonally at the same speed
     if (moveX && moveY)
     {
@@ -304,25 +99,74 @@ static inline void update_player() {
     }
 
     // Apply Rotation. No need to check for collisions in a raycaster
-    playerTheta += rotateTheta;
+    player.theta += rotateTheta;
+    PROF_END;
+
+    // Apply translation, stopping and sliding at walls
+    PROF_BEGIN("collision");
+    s16 yDir = lu_sin(player.theta);
+    s16 yLatDir = lu_sin(player.theta - LU_PI/2);
+    s16 xDir = lu_cos(player.theta);
+    s16 xLatDir = lu_cos(player.theta - LU_PI/2);
+    s32 deltaY = fixed_mul(moveY, yDir) + fixed_mul(moveX, yLatDir);
+    s32 deltaX = fixed_mul(moveY, xDir) + fixed_mul(moveX, xLatDir);
+    POINT moved = move_player(player.x, player.y, deltaX, deltaY);
+    player.x = moved.x;
+    player.y = moved.y;
+    PROF_END;
+}
 
-    // Apply translation per axis
-    s16 yDir = lu_sin(playerTheta);
-    s16 yLatDir = lu_sin(playerTheta - LU_PI/2);
-    s16 deltaY = fixed_mul(moveY, yDir) + fixed_mul(moveX, yLatDir);
-    s16 safeStepsY = clamp_steps(playerY, deltaY, playerX, true);
-    playerY += safeStepsY;
+// Place the view alpha of the way from the tick before the last one to it
+static inline void interpolate_view(s32 alpha) {
+    playerX = lastPlayer.x + fixed_mul(player.x - lastPlayer.x, alpha);
+    playerY = lastPlayer.y + fixed_mul(player.y - lastPlayer.y, alpha);
+    // Wrapped difference, so turning past angle 0 takes the short way
+    playerTheta = lastPlayer.theta
+        + fixed_mul((s32)(player.theta - lastPlayer.theta), alpha);
+}
 
-    s16 xDir = lu_cos(playerTheta);
-    s16 xLatDir = lu_cos(playerTheta - LU_PI/2);
-    s16 deltaX = fixed_mul(moveY, xDir) + fixed_mul(moveX, xLatDir);
-    s16 safeStepsX = clamp_steps(playerX, deltaX, playerY, false);
-    playerX += safeStepsX;
+static inline void draw_view(void) {
+    PROF_BEGIN("stream");
+    map_stream_update(fixed_to_int(playerX)/TILE_SIZE,
+        fixed_to_int(playerY)/TILE_SIZE, playerTheta);
+    PROF_END;
+    cast_direction();
+
+    // Only drawing needs the back page, so the cast overlaps the wait for
+    // the last frame's flip
+    PROF_BEGIN("wait");
+    frame_wait();
+    PROF_END;
+    TTC *tc = tte_get_context();
+    tc->dst.data  = back_page();
+    tc->dst.pitch = SCREEN_WIDTH;
 
     render_direction();
-    //tte_write("#{P:50,0}");
-    //tte_erase_line();
-    //tte_printf("fps: %d", fps);
+    // Stage timings and missed frames, while SELECT is held
+    if (key_is_down(KEY_SELECT)) {
+        PROF_BEGIN("text");
+        prof_draw();
+        tte_printf("#{P:0,%d}", FRAME_STATS_Y);
+        tte_erase_line();
+        tte_printf("late %u dropped %u", (uint)frameStats.late,
+            (uint)frameStats.dropped);
+        PROF_END;
+    }
+}
+
+
+static inline void place_sprites(void) {
+    spriteCount = 0;
+    for (u32 y = 0; y < MAP_HEIGHT; y++) {
+        for (u32 x = 0; x < MAP_WIDTH; x++) {
+            if (!spriteMap[y][x] || spriteCount == MAX_SPRITES)
+                continue;
+            Sprite *sprite = &sprites[spriteCount++];
+            sprite->x = INT_TO_FIXED(x*TILE_SIZE) + HALF_TILE_FIXED;
+            sprite->y = INT_TO_FIXED(y*TILE_SIZE) + HALF_TILE_FIXED;
+            sprite->texture = spriteMap[y][x] - 1;
+        }
+    }
 }
 
 
@@ -335,10 +179,10 @@ static inline void init_timebase(void) {
      * These are 16-Bit registers  so they will overflow when the CNT hits 65536.
      * That means that using the default /1 SYSCLK, will have the register 
      * overflowing every (1/16.7 MHz) * 65536 =  3.9 milliseconds. This is
-     * shorter than 1 frame, so it's not an ideal way to count fps.
+     * shorter than 1 frame, so it's not an ideal way to time frames.
      * with /64 SYSCLK, overflow would happen at  (1/262 kHz)* 65536 = 250 ms.
-     * Thus, this is the highest resolution timer that can be used to count
-     * frames and calculate FPS */
+     * Thus, this is the highest resolution timer that can be used to time
+     * frames. The profiler counts cycles on TM2/TM3 */
     REG_TM0CNT_H = TM_ENABLE | TM_FREQ_64;
     lastTicks = REG_TM0CNT_L;
 }
@@ -346,31 +190,103 @@ static inline void init_timebase(void) {
 
 static inline void calc_delta_time(void) {
     u16 now  = REG_TM0CNT_L;
-    dt = now - lastTicks;
+    dt = replay_dt(now - lastTicks);
     lastTicks = now;
+}
 
-    /* FPS = frames/seconds = 1/(diff * 1/262144)
-     * Simplifying: FPS = 262144/diff.
-     * Added diff/2 to round correctly */
-    fps = dt
-             ? (SYSCLK_64 + dt/2) / dt
-             : 0;
+
+static void run_frame(void) {
+    calc_delta_time();
+
+    // The simulation keeps its own fixed pace, whatever the frame took
+    replay_key_poll();
+    for (u32 ticks = tick_advance(dt); ticks; ticks--) {
+        simulate_tick();
+    }
+    interpolate_view(tick_alpha());
+    draw_view();
+    frame_submit();
+    prof_frame();
+}
+
+
+#if BENCH
+enum BenchConsts {
+    // 60 fps, in TM0 ticks at /64
+    BENCH_DT = SYSCLK_64/60,
+    // Frames a full turn takes at BENCH_DT
+    BENCH_SPIN_FRAMES = 322,
+};
+
+static const ReplayStep corridorSteps[] = {
+    { 120, KEY_UP, BENCH_DT },
+};
+
+static const ReplayStep openRoomSteps[] = {
+    { 60, KEY_UP | KEY_R, BENCH_DT },
+    { 60, KEY_L, BENCH_DT },
+};
+
+static const ReplayStep wallSteps[] = {
+    { 60, KEY_UP, BENCH_DT },
+};
+
+static const ReplayStep spinSteps[] = {
+    { BENCH_SPIN_FRAMES, KEY_RIGHT, BENCH_DT },
+};
+
+#define TILE_CENTER(t) (INT_TO_FIXED((t)*TILE_SIZE) + HALF_TILE_FIXED)
+
+static const BenchScenario benchScenarios[] = {
+    // Down the open top row, with its far wall in view
+    { "corridor", TILE_CENTER(1), TILE_CENTER(1), 0,
+        corridorSteps, countof(corridorSteps) },
+    // Strafing across the open bottom left, facing the pillars
+    { "open", TILE_CENTER(1), TILE_CENTER(6), 0xE000,
+        openRoomSteps, countof(openRoomSteps) },
+    // Pressed against the west wall, every column at the nearest distance
+    { "wall", TILE_CENTER(1), TILE_CENTER(4), 0x8000,
+        wallSteps, countof(wallSteps) },
+    { "spin", TILE_CENTER(2), TILE_CENTER(5), 0,
+        spinSteps, countof(spinSteps) },
+};
+
+// Every scenario starts cold, whatever ran before it: no chunks cached
+// and the sprites back in their first draw order
+static void set_bench_pose(const BenchScenario *scenario) {
+    map_stream_open(&worldMap);
+    init_sprite_tables();
+    player.x = scenario->x;
+    player.y = scenario->y;
+    player.theta = scenario->theta;
+    lastPlayer = player;
+    tick_reset();
 }
+#endif
 
 
 int main() {
     REG_DISPCNT = DCNT_MODE4 | DCNT_BG2;
+    // 3/1 ROM wait states with prefetch, instead of the 4/2 reset default
+    REG_WAITCNT = WS_STANDARD;
 
     tte_init_bmp(DCNT_MODE4, NULL, NULL);
     tte_init_con();
     init_timebase();
+    prof_init();
+    map_stream_open(&worldMap);
+    init_ray_tables();
+    init_sprite_tables();
+    place_sprites();
 
     // Set up colors
     // Black background
     pal_bg_mem[BLACK_COLOR_IDX] = RGB15(0, 0, 0) | BIT(15);
-    // Purple walls
-    pal_bg_mem[LIGHT_WALL_COLOR_IDX] = RGB15(16, 0, 31) | BIT(15);
-    pal_bg_mem[DARK_WALL_COLOR_IDX] = RGB15(8, 0, 16) | BIT(15);
+    // Wall textures
+    memcpy16(&pal_bg_mem[WALL_PALETTE_START], wallPalette, WALL_PALETTE_SIZE);
+    // Sprite textures
+    memcpy16(&pal_bg_mem[SPRITE_PALETTE_START], spritePalette,
+        SPRITE_PALETTE_SIZE);
     // Green player
     pal_bg_mem[PLAYER_COLOR_IDX] = RGB15(0, 31, 0) | BIT(15);
     // Red ground
@@ -385,16 +301,14 @@ int main() {
      * vid_flip();
      * draw_map(MAP_X, MAP_Y);
     */
+#if BENCH
+    bench_run("m4-raycaster", benchScenarios, countof(benchScenarios),
+        set_bench_pose, run_frame);
+#endif
+    tick_reset();
+    frame_init(FRAME_VBLANKS);
     while (1) {
-        vid_vsync();
-        calc_delta_time();
-
-        TTC *tc = tte_get_context();
-        tc->dst.data  = back_page();
-        tc->dst.pitch = SCREEN_WIDTH;
-
-        update_player();
-        vid_flip();
+        run_frame();
     }
 }
 
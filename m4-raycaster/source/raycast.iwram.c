@@ -0,0 +1,231 @@
+#include "prof.h"
+#include "raycaster.h"
+#include "textures.h"
+#include "tonc_core.h"
+#include "tonc_math.h"
+#include "tonc_video.h"
+
+/*
+ * Per-column ray values (angle offset, fish-eye cosine and the DDA
+ * reciprocals) come from tables built once at startup. Build with
+ * RAY_TABLES set to 0 to compute them every frame instead and compare the
+ * cycle counts shown while SELECT is held.
+ */
+#ifndef RAY_TABLES
+#define RAY_TABLES 1
+#endif
+
+// Screen columns per ray. 2 casts 120 rays and draws each one twice as wide
+#ifndef RAY_COLUMN_WIDTH
+#define RAY_COLUMN_WIDTH 1
+#endif
+
+// Angle of each column's ray relative to the player's heading
+static s16 columnAngles[SCREEN_WIDTH];
+// Fish-eye correction factor of each column, cos(columnAngles[i])
+static s16 columnCosines[SCREEN_WIDTH];
+// 1/|sin| for every sin_lut entry, DDA distance between grid lines
+static s32 invAbsSines[ANGLE_LUT_SIZE];
+// Wall span of every screen column for this frame
+static ColumnSpan columns[SCREEN_WIDTH];
+// Distance to the wall drawn in every screen column for this frame
+static s32 zBuffer[SCREEN_WIDTH];
+// Texture rows per screen row for every wall height, .16 fixed point
+u32 texSteps[MAX_WALL_HEIGHT + 1];
+// IWRAM copy of the ROM textures, read without wait states
+static u8 textureCache[WALL_TEXTURE_COUNT][RAY_SIDES][TEX_SIZE][TEX_SIZE];
+
+static inline s32 calc_column_angle(u32 column) {
+    return -FOV/2 + fixed_mul((int_to_fixed(column)/SCREEN_WIDTH), FOV);
+}
+
+static inline s32 calc_inv_abs_sin(u32 lutIndex) {
+    s32 sine = fixed_abs(sin_lut[lutIndex]);
+    // sin is only zero along an axis, where the distance between grid lines
+    // of the other axis is infinite. The smallest non-zero sine already
+    // yields a value the DDA never picks
+    return fixed_div(FIXED_ONE, sine ? sine : 1);
+}
+
+void init_ray_tables(void) {
+    for (u32 i = 0; i < SCREEN_WIDTH; i++) {
+        columnAngles[i] = calc_column_angle(i);
+        columnCosines[i] = lu_cos(columnAngles[i]);
+    }
+    for (u32 i = 0; i < ANGLE_LUT_SIZE; i++) {
+        invAbsSines[i] = calc_inv_abs_sin(i);
+    }
+    // Rounding the step down keeps the last row of a wall inside the texture
+    texSteps[0] = 0;
+    for (u32 i = 1; i <= MAX_WALL_HEIGHT; i++) {
+        texSteps[i] = (TEX_SIZE << TEX_V_SHIFT) / i;
+    }
+    memcpy32(textureCache, wallTextures, sizeof(textureCache)/4);
+}
+
+#if RAY_TABLES
+static inline s32 column_angle(u32 column) {
+    return columnAngles[column];
+}
+
+static inline s32 column_cosine(u32 column) {
+    return columnCosines[column];
+}
+
+static inline s32 inv_abs_sin(u32 angle) {
+    return invAbsSines[(angle >> ANGLE_LUT_SHIFT) & (ANGLE_LUT_SIZE - 1)];
+}
+#else
+static inline s32 column_angle(u32 column) {
+    return calc_column_angle(column);
+}
+
+static inline s32 column_cosine(u32 column) {
+    return lu_cos(calc_column_angle(column));
+}
+
+static inline s32 inv_abs_sin(u32 angle) {
+    return calc_inv_abs_sin((angle >> ANGLE_LUT_SHIFT) & (ANGLE_LUT_SIZE - 1));
+}
+#endif
+
+static inline s32 inv_abs_cos(u32 angle) {
+    return inv_abs_sin(angle + (ANGLE_LUT_QUARTER << ANGLE_LUT_SHIFT));
+}
+
+
+/*
+ * Grid DDA (digital differential analyzer). Instead of marching the ray in
+ * fixed steps, jump from one tile boundary to the next, always taking the
+ * closer of the next vertical or horizontal grid line, and stop at the first
+ * wall tile. The cost scales with the number of tiles crossed, and the hit
+ * distance is exact instead of being rounded to the step size.
+ * Distances inside the loop are fixed point tile units.
+ */
+static inline RayHit cast_ray(s32 originX, s32 originY, u32 rayAngle) {
+    RayHit hit = { RAY_LENGTH, RAY_SIDE_EW, 0, 0 };
+    s32 xDir = lu_cos(rayAngle);
+    s32 yDir = lu_sin(rayAngle);
+    s32 posX = originX / TILE_SIZE;
+    s32 posY = originY / TILE_SIZE;
+    s32 mapX = posX >> FIXED_SHIFT;
+    s32 mapY = posY >> FIXED_SHIFT;
+
+    // Distance along the ray between two consecutive vertical (X) or
+    // horizontal (Y) grid lines
+    s32 deltaDistX = inv_abs_cos(rayAngle);
+    s32 deltaDistY = inv_abs_sin(rayAngle);
+
+    // Distance along the ray to the first grid line on each axis
+    s32 stepX, stepY, sideDistX, sideDistY;
+    if (xDir < 0) {
+        stepX = -1;
+        sideDistX = fixed_mul(posX - int_to_fixed(mapX), deltaDistX);
+    }
+    else {
+        stepX = 1;
+        sideDistX = fixed_mul(int_to_fixed(mapX + 1) - posX, deltaDistX);
+    }
+    if (yDir < 0) {
+        stepY = -1;
+        sideDistY = fixed_mul(posY - int_to_fixed(mapY), deltaDistY);
+    }
+    else {
+        stepY = 1;
+        sideDistY = fixed_mul(int_to_fixed(mapY + 1) - posY, deltaDistY);
+    }
+
+    if (!map_stream_in_bounds(mapX, mapY))
+        return hit;
+    // Decoded chunk the ray is in, only looked up again when it leaves it
+    const MapChunk *chunk = map_stream_chunk(mapX, mapY);
+    s32 chunkX = mapX >> MAP_CHUNK_SHIFT;
+    s32 chunkY = mapY >> MAP_CHUNK_SHIFT;
+    s32 dist;
+    u16 side;
+    while (1) {
+        if (sideDistX < sideDistY) {
+            dist = sideDistX;
+            sideDistX += deltaDistX;
+            mapX += stepX;
+            side = RAY_SIDE_EW;
+        }
+        else {
+            dist = sideDistY;
+            sideDistY += deltaDistY;
+            mapY += stepY;
+            side = RAY_SIDE_NS;
+        }
+        if (dist * TILE_SIZE >= RAY_LENGTH)
+            return hit;
+        // Do not check out of bounds
+        if (!map_stream_in_bounds(mapX, mapY))
+            return hit;
+        if ((mapX >> MAP_CHUNK_SHIFT) != chunkX
+                || (mapY >> MAP_CHUNK_SHIFT) != chunkY) {
+            chunk = map_stream_chunk(mapX, mapY);
+            chunkX = mapX >> MAP_CHUNK_SHIFT;
+            chunkY = mapY >> MAP_CHUNK_SHIFT;
+        }
+        if (map_chunk_solid(chunk, mapX, mapY))
+            break;
+    }
+
+    // Position of the hit along the wall face gives the texture column.
+    // Mirror it where needed so textures read left to right on every face
+    s32 wallPos = side == RAY_SIDE_EW
+        ? posY + fixed_mul(dist, yDir)
+        : posX + fixed_mul(dist, xDir);
+    u16 texX = (wallPos & (FIXED_ONE - 1)) >> (FIXED_SHIFT - TEX_SHIFT);
+    if ((side == RAY_SIDE_EW && xDir < 0) || (side == RAY_SIDE_NS && yDir > 0)) {
+        texX = TEX_SIZE - 1 - texX;
+    }
+
+    hit.dist = dist * TILE_SIZE;
+    hit.side = side;
+    hit.texX = texX;
+    hit.tile = map_chunk_tile(chunk, mapX, mapY);
+    return hit;
+}
+
+IWRAM_CODE void cast_direction(void) {
+    PROF_BEGIN("cast");
+    for (u32 i = 0; i < SCREEN_WIDTH; i += RAY_COLUMN_WIDTH) {
+        ColumnSpan span = { NULL, 0, 0, SCREEN_HEIGHT/2, SCREEN_HEIGHT/2 };
+        s32 depth = RAY_LENGTH;
+        RayHit hit = cast_ray(playerX, playerY, playerTheta + column_angle(i));
+        // An empty span if no wall is within range
+        if (hit.tile) {
+            // Fish-eye correction
+            depth = fixed_mul(hit.dist, column_cosine(i));
+            s32 lineHeight = wall_height(depth);
+            s32 top = SCREEN_HEIGHT/2 - lineHeight/2;
+            s32 bottom = top + lineHeight;
+            // Walls taller than the screen start part way down the texture
+            span.texStep = texSteps[lineHeight];
+            if (top < 0) {
+                span.texV = -top * span.texStep;
+                top = 0;
+            }
+            if (bottom > SCREEN_HEIGHT) {
+                bottom = SCREEN_HEIGHT;
+            }
+            u32 texture = hit.tile <= WALL_TEXTURE_COUNT ? hit.tile - 1 : 0;
+            span.texels = textureCache[texture][hit.side][hit.texX];
+            span.top = top;
+            span.bottom = bottom;
+        }
+        for (u32 j = 0; j < RAY_COLUMN_WIDTH; j++) {
+            columns[i + j] = span;
+            zBuffer[i + j] = depth;
+        }
+    }
+    PROF_END;
+}
+
+IWRAM_CODE void render_direction(void) {
+    draw_columns(columns);
+    PROF_BEGIN("sprites");
+    draw_sprites(zBuffer);
+    PROF_END;
+}
@@ -0,0 +1,158 @@
+#include "raycaster.h"
+#include "textures.h"
+#include "tonc_bios.h"
+#include "tonc_core.h"
+#include "tonc_math.h"
+#include "tonc_video.h"
+
+enum SpriteDrawConsts {
+    // Halfwords per mode 4 line
+    LINE_HALFWORDS = SCREEN_WIDTH/2,
+    // Sprites closer than this are inside the player and not drawn
+    MIN_SPRITE_DEPTH = PLAYER_RADIUS,
+    // ArcTan2 takes s16 arguments, so offsets are shifted down to .4 pixels
+    ATAN_SHIFT = FIXED_SHIFT - 4,
+};
+
+// Where a sprite lands on screen this frame
+typedef struct ProjectedSprite {
+    // Distance along the view direction, like zBuffer. 0 when not drawn
+    s32 depth;
+    // Screen column of the sprite's center, may be off screen
+    s16 centerX;
+    // Height and width on screen in pixels
+    u16 size;
+} ProjectedSprite;
+
+static ProjectedSprite projected[MAX_SPRITES];
+// Sprite indices from farthest to closest
+static u8 drawOrder[MAX_SPRITES];
+// IWRAM copy of the ROM sprite textures
+static u8 spriteCache[SPRITE_TEXTURE_COUNT][TEX_SIZE][TEX_SIZE];
+
+void init_sprite_tables(void) {
+    for (u32 i = 0; i < MAX_SPRITES; i++) {
+        drawOrder[i] = i;
+    }
+    memcpy32(spriteCache, spriteTextures, sizeof(spriteCache)/4);
+}
+
+/*
+ * Place a sprite on screen the same way cast_direction places walls.
+ * Columns are spread evenly by angle, not across a flat projection plane,
+ * so the sprite's column comes from its angle off the view direction, and
+ * its size from its distance along it, as for the fish-eye corrected walls.
+ */
+static inline ProjectedSprite project_sprite(const Sprite *sprite,
+    s32 cosTheta,
+    s32 sinTheta)
+{
+    ProjectedSprite p = { 0, 0, 0 };
+    s32 dx = sprite->x - (s32)playerX;
+    s32 dy = sprite->y - (s32)playerY;
+    s32 depth = fixed_mul(dx, cosTheta) + fixed_mul(dy, sinTheta);
+    // Behind the player or beyond the walls' range
+    if (depth < MIN_SPRITE_DEPTH || depth >= RAY_LENGTH)
+        return p;
+    s16 angle = ArcTan2(dx >> ATAN_SHIFT, dy >> ATAN_SHIFT) - playerTheta;
+    p.depth = depth;
+    p.centerX = SCREEN_WIDTH/2 + angle * SCREEN_WIDTH / FOV;
+    p.size = wall_height(depth);
+    return p;
+}
+
+/*
+ * Sort drawOrder by depth, farthest first. Sprites and the player move
+ * little from one frame to the next, so the order kept from the previous
+ * frame is almost sorted already and insertion sort does close to one
+ * comparison per sprite. Sprites that are not drawn end up last.
+ */
+static inline void sort_sprites(void) {
+    for (u32 i = 1; i < MAX_SPRITES; i++) {
+        u8 index = drawOrder[i];
+        s32 depth = projected[index].depth;
+        u32 j = i;
+        while (j > 0 && projected[drawOrder[j - 1]].depth < depth) {
+            drawOrder[j] = drawOrder[j - 1];
+            j--;
+        }
+        drawOrder[j] = index;
+    }
+}
+
+// Write one texel into a mode 4 halfword, keeping its other pixel
+static inline void plot_texel(u16 *dst, u32 odd, u8 texel) {
+    *dst = odd
+        ? (*dst & 0x00FF) | (texel << 8)
+        : (*dst & 0xFF00) | texel;
+}
+
+/*
+ * Draw a sprite one screen column (stripe) at a time. A stripe is skipped
+ * where the wall in that column is closer, and transparent texels are not
+ * written. Sprites are square, so the same step walks the texture across
+ * and down.
+ */
+static inline void draw_sprite(const ProjectedSprite *p,
+    const u8 (*texture)[TEX_SIZE],
+    const s32 *zBuffer)
+{
+    u32 step = texSteps[p->size];
+    s32 left = p->centerX - p->size/2;
+    s32 right = left + p->size;
+    s32 top = SCREEN_HEIGHT/2 - p->size/2;
+    s32 bottom = top + p->size;
+    u32 startU = 0, startV = 0;
+    if (left < 0) {
+        startU = -left * step;
+        left = 0;
+    }
+    if (right > SCREEN_WIDTH) {
+        right = SCREEN_WIDTH;
+    }
+    if (top < 0) {
+        startV = -top * step;
+        top = 0;
+    }
+    if (bottom > SCREEN_HEIGHT) {
+        bottom = SCREEN_HEIGHT;
+    }
+
+    u16 *page = (u16*)vid_page + top*LINE_HALFWORDS;
+    u32 u = startU;
+    for (s32 x = left; x < right; x++, u += step) {
+        if (p->depth >= zBuffer[x])
+            continue;
+        const u8 *texels = texture[u >> TEX_V_SHIFT];
+        u16 *dst = page + x/2;
+        u32 v = startV;
+        for (s32 y = top; y < bottom; y++, v += step, dst += LINE_HALFWORDS) {
+            u8 texel = texels[v >> TEX_V_SHIFT];
+            if (texel != TRANSPARENT_TEXEL) {
+                plot_texel(dst, x & 1, texel);
+            }
+        }
+    }
+}
+
+IWRAM_CODE void draw_sprites(const s32 *zBuffer) {
+    s32 cosTheta = lu_cos(playerTheta);
+    s32 sinTheta = lu_sin(playerTheta);
+    for (u32 i = 0; i < MAX_SPRITES; i++) {
+        if (i < spriteCount) {
+            projected[i] = project_sprite(&sprites[i], cosTheta, sinTheta);
+        }
+        else {
+            projected[i].depth = 0;
+        }
+    }
+    sort_sprites();
+    for (u32 i = 0; i < MAX_SPRITES; i++) {
+        const ProjectedSprite *p = &projected[drawOrder[i]];
+        if (!p->depth)
+            break;
+        u32 texture = sprites[drawOrder[i]].texture;
+        draw_sprite(p, spriteCache[texture < SPRITE_TEXTURE_COUNT ? texture : 0],
+            zBuffer);
+    }
+}
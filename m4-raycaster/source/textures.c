@@ -0,0 +1,1068 @@
+// Generated by tools/gen_textures.c, do not edit
+#include "textures.h"
+
+const u16 wallPalette[WALL_PALETTE_SIZE] = {
+    0x2046, 0x2C48, 0x386A, 0x486D, 0x548F, 0x60B1, 0x70B4, 0x7CD6,
+    0x1023, 0x1824, 0x2046, 0x2847, 0x3048, 0x346A, 0x3C6B, 0x446C,
+    0x1CC5, 0x2507, 0x3149, 0x3DAB, 0x49EE, 0x5230, 0x5E92, 0x6AD4,
+    0x1063, 0x1484, 0x1CC5, 0x20E6, 0x2907, 0x2D49, 0x356A, 0x398B,
+    0x0887, 0x08CA, 0x0CED, 0x0D30, 0x1173, 0x15B6, 0x15D9, 0x1A1C,
+    0x0444, 0x0466, 0x0887, 0x08A9, 0x08CA, 0x0CEC, 0x0D0E, 0x0D2F,
+};
+
+const u8 wallTextures[WALL_TEXTURE_COUNT][RAY_SIDES][TEX_SIZE][TEX_SIZE] = {
+    {
+        {
+            {
+                22, 20, 21, 21, 21, 20, 21, 17, 22, 21, 22, 21, 22, 21, 21, 17,
+                23, 22, 22, 22, 22, 22, 22, 17, 23, 21, 21, 21, 22, 22, 22, 17,
+            },
+            {
+                21, 21, 20, 21, 21, 20, 21, 17, 23, 21, 21, 21, 22, 21, 22, 17,
+                23, 22, 22, 22, 22, 22, 22, 17, 23, 21, 21, 21, 22, 21, 22, 17,
+            },
+            {
+                21, 20, 21, 21, 20, 21, 21, 17, 23, 22, 21, 22, 22, 22, 21, 17,
+                23, 22, 22, 22, 22, 22, 22, 17, 23, 21, 21, 22, 21, 22, 22, 17,
+            },
+            {
+                21, 21, 21, 21, 21, 20, 21, 17, 23, 22, 21, 22, 21, 21, 21, 17,
+                23, 22, 22, 22, 22, 22, 22, 17, 23, 22, 22, 21, 22, 21, 22, 17,
+            },
+            {
+                22, 21, 21, 21, 21, 20, 20, 17, 22, 21, 22, 22, 21, 22, 21, 17,
+                23, 22, 22, 22, 22, 22, 22, 17, 22, 22, 22, 21, 22, 21, 21, 17,
+            },
+            {
+                22, 21, 21, 21, 21, 21, 21, 17, 22, 22, 21, 22, 22, 21, 21, 17,
+                23, 22, 22, 22, 22, 22, 22, 17, 23, 21, 21, 21, 22, 22, 21, 17,
+            },
+            {
+                22, 21, 21, 21, 21, 21, 21, 17, 22, 21, 21, 22, 22, 22, 21, 17,
+                23, 22, 22, 22, 22, 22, 22, 17, 22, 21, 21, 21, 22, 22, 21, 17,
+            },
+            {
+                22, 21, 21, 21, 21, 21, 21, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+                23, 22, 22, 22, 22, 22, 22, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+            },
+            {
+                22, 21, 21, 20, 21, 20, 21, 17, 22, 22, 22, 21, 22, 22, 22, 17,
+                23, 22, 22, 22, 22, 22, 21, 17, 22, 21, 22, 22, 21, 21, 21, 17,
+            },
+            {
+                22, 21, 21, 21, 21, 21, 21, 17, 23, 21, 22, 22, 21, 21, 22, 17,
+                23, 22, 22, 22, 22, 22, 22, 17, 23, 21, 21, 22, 22, 22, 22, 17,
+            },
+            {
+                21, 21, 21, 21, 21, 21, 21, 17, 22, 22, 22, 21, 22, 22, 21, 17,
+                23, 22, 22, 22, 22, 22, 22, 17, 22, 21, 22, 22, 21, 22, 22, 17,
+            },
+            {
+                22, 20, 21, 21, 20, 21, 21, 17, 23, 21, 22, 22, 21, 21, 21, 17,
+                23, 22, 22, 22, 22, 22, 22, 17, 23, 21, 22, 22, 22, 22, 21, 17,
+            },
+            {
+                21, 21, 20, 21, 21, 21, 21, 17, 23, 22, 22, 21, 22, 22, 22, 17,
+                23, 22, 22, 22, 22, 22, 22, 17, 23, 22, 22, 22, 22, 22, 22, 17,
+            },
+            {
+                22, 21, 21, 21, 21, 20, 21, 17, 22, 22, 22, 22, 21, 22, 21, 17,
+                23, 22, 22, 22, 21, 22, 22, 17, 23, 21, 22, 21, 21, 21, 21, 17,
+            },
+            {
+                22, 20, 21, 20, 21, 21, 21, 17, 23, 22, 22, 22, 21, 22, 21, 17,
+                23, 22, 22, 22, 22, 22, 22, 17, 22, 22, 21, 22, 21, 22, 21, 17,
+            },
+            {
+                17, 17, 17, 17, 17, 17, 17, 17, 22, 22, 22, 22, 21, 22, 22, 17,
+                17, 17, 17, 17, 17, 17, 17, 17, 23, 22, 22, 22, 22, 22, 22, 17,
+            },
+            {
+                21, 21, 21, 21, 21, 20, 21, 17, 22, 22, 21, 22, 21, 22, 22, 17,
+                23, 21, 22, 22, 22, 22, 22, 17, 23, 21, 22, 22, 22, 21, 22, 17,
+            },
+            {
+                22, 21, 21, 21, 21, 21, 21, 17, 23, 21, 22, 21, 22, 22, 22, 17,
+                23, 22, 22, 22, 22, 22, 21, 17, 22, 21, 22, 22, 21, 21, 22, 17,
+            },
+            {
+                22, 21, 20, 21, 21, 21, 21, 17, 22, 22, 21, 22, 21, 22, 21, 17,
+                23, 21, 22, 21, 21, 22, 21, 17, 22, 21, 22, 22, 22, 21, 22, 17,
+            },
+            {
+                22, 21, 21, 21, 20, 21, 21, 17, 22, 22, 22, 22, 21, 22, 22, 17,
+                23, 22, 22, 22, 22, 22, 21, 17, 22, 22, 22, 21, 21, 22, 22, 17,
+            },
+            {
+                22, 21, 20, 21, 21, 20, 21, 17, 23, 21, 22, 22, 21, 22, 21, 17,
+                23, 21, 22, 21, 22, 21, 22, 17, 23, 22, 21, 21, 22, 21, 21, 17,
+            },
+            {
+                22, 20, 21, 20, 21, 21, 21, 17, 23, 22, 22, 22, 21, 21, 22, 17,
+                23, 22, 22, 21, 22, 22, 21, 17, 23, 21, 21, 22, 21, 21, 22, 17,
+            },
+            {
+                22, 21, 21, 21, 21, 21, 20, 17, 23, 21, 21, 22, 22, 21, 22, 17,
+                22, 22, 22, 22, 22, 22, 22, 17, 23, 22, 22, 22, 22, 22, 21, 17,
+            },
+            {
+                22, 21, 21, 21, 21, 21, 21, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+                23, 22, 21, 22, 22, 22, 22, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+            },
+            {
+                21, 20, 21, 21, 21, 21, 21, 17, 22, 21, 21, 21, 21, 22, 22, 17,
+                22, 22, 22, 22, 21, 22, 22, 17, 23, 22, 22, 21, 22, 22, 22, 17,
+            },
+            {
+                22, 21, 20, 21, 21, 21, 21, 17, 23, 21, 22, 21, 21, 22, 22, 17,
+                23, 22, 22, 22, 22, 22, 21, 17, 22, 22, 21, 22, 21, 21, 22, 17,
+            },
+            {
+                22, 21, 21, 21, 21, 21, 20, 17, 22, 22, 21, 22, 22, 22, 22, 17,
+                23, 22, 22, 21, 22, 22, 22, 17, 23, 22, 21, 22, 22, 21, 22, 17,
+            },
+            {
+                22, 21, 21, 20, 21, 21, 21, 17, 22, 21, 22, 21, 22, 22, 21, 17,
+                23, 22, 21, 22, 22, 22, 22, 17, 22, 21, 22, 22, 21, 21, 21, 17,
+            },
+            {
+                22, 21, 21, 21, 21, 21, 21, 17, 23, 22, 21, 21, 22, 21, 21, 17,
+                23, 22, 22, 22, 22, 22, 21, 17, 22, 22, 22, 22, 22, 22, 22, 17,
+            },
+            {
+                22, 21, 21, 21, 20, 21, 21, 17, 23, 22, 21, 22, 21, 21, 21, 17,
+                23, 22, 22, 22, 22, 22, 22, 17, 22, 22, 22, 22, 21, 21, 22, 17,
+            },
+            {
+                21, 21, 21, 21, 21, 21, 21, 17, 23, 22, 22, 21, 22, 21, 22, 17,
+                23, 22, 22, 22, 22, 21, 22, 17, 23, 21, 22, 21, 22, 22, 22, 17,
+            },
+            {
+                17, 17, 17, 17, 17, 17, 17, 17, 22, 21, 21, 21, 22, 22, 21, 17,
+                17, 17, 17, 17, 17, 17, 17, 17, 23, 21, 22, 22, 22, 21, 21, 17,
+            },
+        },
+        {
+            {
+                30, 28, 29, 29, 29, 28, 29, 25, 30, 29, 30, 29, 30, 29, 29, 25,
+                31, 30, 30, 30, 30, 30, 30, 25, 31, 29, 29, 29, 30, 30, 30, 25,
+            },
+            {
+                29, 29, 28, 29, 29, 28, 29, 25, 31, 29, 29, 29, 30, 29, 30, 25,
+                31, 30, 30, 30, 30, 30, 30, 25, 31, 29, 29, 29, 30, 29, 30, 25,
+            },
+            {
+                29, 28, 29, 29, 28, 29, 29, 25, 31, 30, 29, 30, 30, 30, 29, 25,
+                31, 30, 30, 30, 30, 30, 30, 25, 31, 29, 29, 30, 29, 30, 30, 25,
+            },
+            {
+                29, 29, 29, 29, 29, 28, 29, 25, 31, 30, 29, 30, 29, 29, 29, 25,
+                31, 30, 30, 30, 30, 30, 30, 25, 31, 30, 30, 29, 30, 29, 30, 25,
+            },
+            {
+                30, 29, 29, 29, 29, 28, 28, 25, 30, 29, 30, 30, 29, 30, 29, 25,
+                31, 30, 30, 30, 30, 30, 30, 25, 30, 30, 30, 29, 30, 29, 29, 25,
+            },
+            {
+                30, 29, 29, 29, 29, 29, 29, 25, 30, 30, 29, 30, 30, 29, 29, 25,
+                31, 30, 30, 30, 30, 30, 30, 25, 31, 29, 29, 29, 30, 30, 29, 25,
+            },
+            {
+                30, 29, 29, 29, 29, 29, 29, 25, 30, 29, 29, 30, 30, 30, 29, 25,
+                31, 30, 30, 30, 30, 30, 30, 25, 30, 29, 29, 29, 30, 30, 29, 25,
+            },
+            {
+                30, 29, 29, 29, 29, 29, 29, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+                31, 30, 30, 30, 30, 30, 30, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+            },
+            {
+                30, 29, 29, 28, 29, 28, 29, 25, 30, 30, 30, 29, 30, 30, 30, 25,
+                31, 30, 30, 30, 30, 30, 29, 25, 30, 29, 30, 30, 29, 29, 29, 25,
+            },
+            {
+                30, 29, 29, 29, 29, 29, 29, 25, 31, 29, 30, 30, 29, 29, 30, 25,
+                31, 30, 30, 30, 30, 30, 30, 25, 31, 29, 29, 30, 30, 30, 30, 25,
+            },
+            {
+                29, 29, 29, 29, 29, 29, 29, 25, 30, 30, 30, 29, 30, 30, 29, 25,
+                31, 30, 30, 30, 30, 30, 30, 25, 30, 29, 30, 30, 29, 30, 30, 25,
+            },
+            {
+                30, 28, 29, 29, 28, 29, 29, 25, 31, 29, 30, 30, 29, 29, 29, 25,
+                31, 30, 30, 30, 30, 30, 30, 25, 31, 29, 30, 30, 30, 30, 29, 25,
+            },
+            {
+                29, 29, 28, 29, 29, 29, 29, 25, 31, 30, 30, 29, 30, 30, 30, 25,
+                31, 30, 30, 30, 30, 30, 30, 25, 31, 30, 30, 30, 30, 30, 30, 25,
+            },
+            {
+                30, 29, 29, 29, 29, 28, 29, 25, 30, 30, 30, 30, 29, 30, 29, 25,
+                31, 30, 30, 30, 29, 30, 30, 25, 31, 29, 30, 29, 29, 29, 29, 25,
+            },
+            {
+                30, 28, 29, 28, 29, 29, 29, 25, 31, 30, 30, 30, 29, 30, 29, 25,
+                31, 30, 30, 30, 30, 30, 30, 25, 30, 30, 29, 30, 29, 30, 29, 25,
+            },
+            {
+                25, 25, 25, 25, 25, 25, 25, 25, 30, 30, 30, 30, 29, 30, 30, 25,
+                25, 25, 25, 25, 25, 25, 25, 25, 31, 30, 30, 30, 30, 30, 30, 25,
+            },
+            {
+                29, 29, 29, 29, 29, 28, 29, 25, 30, 30, 29, 30, 29, 30, 30, 25,
+                31, 29, 30, 30, 30, 30, 30, 25, 31, 29, 30, 30, 30, 29, 30, 25,
+            },
+            {
+                30, 29, 29, 29, 29, 29, 29, 25, 31, 29, 30, 29, 30, 30, 30, 25,
+                31, 30, 30, 30, 30, 30, 29, 25, 30, 29, 30, 30, 29, 29, 30, 25,
+            },
+            {
+                30, 29, 28, 29, 29, 29, 29, 25, 30, 30, 29, 30, 29, 30, 29, 25,
+                31, 29, 30, 29, 29, 30, 29, 25, 30, 29, 30, 30, 30, 29, 30, 25,
+            },
+            {
+                30, 29, 29, 29, 28, 29, 29, 25, 30, 30, 30, 30, 29, 30, 30, 25,
+                31, 30, 30, 30, 30, 30, 29, 25, 30, 30, 30, 29, 29, 30, 30, 25,
+            },
+            {
+                30, 29, 28, 29, 29, 28, 29, 25, 31, 29, 30, 30, 29, 30, 29, 25,
+                31, 29, 30, 29, 30, 29, 30, 25, 31, 30, 29, 29, 30, 29, 29, 25,
+            },
+            {
+                30, 28, 29, 28, 29, 29, 29, 25, 31, 30, 30, 30, 29, 29, 30, 25,
+                31, 30, 30, 29, 30, 30, 29, 25, 31, 29, 29, 30, 29, 29, 30, 25,
+            },
+            {
+                30, 29, 29, 29, 29, 29, 28, 25, 31, 29, 29, 30, 30, 29, 30, 25,
+                30, 30, 30, 30, 30, 30, 30, 25, 31, 30, 30, 30, 30, 30, 29, 25,
+            },
+            {
+                30, 29, 29, 29, 29, 29, 29, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+                31, 30, 29, 30, 30, 30, 30, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+            },
+            {
+                29, 28, 29, 29, 29, 29, 29, 25, 30, 29, 29, 29, 29, 30, 30, 25,
+                30, 30, 30, 30, 29, 30, 30, 25, 31, 30, 30, 29, 30, 30, 30, 25,
+            },
+            {
+                30, 29, 28, 29, 29, 29, 29, 25, 31, 29, 30, 29, 29, 30, 30, 25,
+                31, 30, 30, 30, 30, 30, 29, 25, 30, 30, 29, 30, 29, 29, 30, 25,
+            },
+            {
+                30, 29, 29, 29, 29, 29, 28, 25, 30, 30, 29, 30, 30, 30, 30, 25,
+                31, 30, 30, 29, 30, 30, 30, 25, 31, 30, 29, 30, 30, 29, 30, 25,
+            },
+            {
+                30, 29, 29, 28, 29, 29, 29, 25, 30, 29, 30, 29, 30, 30, 29, 25,
+                31, 30, 29, 30, 30, 30, 30, 25, 30, 29, 30, 30, 29, 29, 29, 25,
+            },
+            {
+                30, 29, 29, 29, 29, 29, 29, 25, 31, 30, 29, 29, 30, 29, 29, 25,
+                31, 30, 30, 30, 30, 30, 29, 25, 30, 30, 30, 30, 30, 30, 30, 25,
+            },
+            {
+                30, 29, 29, 29, 28, 29, 29, 25, 31, 30, 29, 30, 29, 29, 29, 25,
+                31, 30, 30, 30, 30, 30, 30, 25, 30, 30, 30, 30, 29, 29, 30, 25,
+            },
+            {
+                29, 29, 29, 29, 29, 29, 29, 25, 31, 30, 30, 29, 30, 29, 30, 25,
+                31, 30, 30, 30, 30, 29, 30, 25, 31, 29, 30, 29, 30, 30, 30, 25,
+            },
+            {
+                25, 25, 25, 25, 25, 25, 25, 25, 30, 29, 29, 29, 30, 30, 29, 25,
+                25, 25, 25, 25, 25, 25, 25, 25, 31, 29, 30, 30, 30, 29, 29, 25,
+            },
+        },
+    },
+    {
+        {
+            {
+                39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+                39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+            },
+            {
+                39, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 33,
+                39, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 33,
+            },
+            {
+                39, 38, 36, 36, 36, 36, 36, 36, 37, 37, 37, 37, 37, 37, 34, 33,
+                39, 38, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 34, 33,
+            },
+            {
+                39, 38, 36, 36, 36, 36, 36, 36, 37, 37, 37, 37, 37, 37, 34, 33,
+                39, 38, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 34, 33,
+            },
+            {
+                39, 38, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 34, 33,
+                39, 38, 37, 37, 37, 37, 37, 37, 36, 36, 37, 37, 36, 36, 34, 33,
+            },
+            {
+                39, 38, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 34, 33,
+                39, 38, 37, 37, 37, 37, 37, 37, 36, 36, 37, 37, 36, 36, 34, 33,
+            },
+            {
+                39, 38, 37, 37, 36, 36, 36, 36, 37, 37, 37, 37, 36, 36, 34, 33,
+                39, 38, 36, 36, 36, 36, 37, 37, 36, 36, 36, 36, 37, 37, 34, 33,
+            },
+            {
+                39, 38, 37, 37, 36, 36, 36, 36, 37, 37, 37, 37, 36, 36, 34, 33,
+                39, 38, 36, 36, 36, 36, 37, 37, 36, 36, 36, 36, 37, 37, 34, 33,
+            },
+            {
+                39, 38, 36, 36, 37, 37, 36, 36, 36, 36, 37, 37, 37, 37, 34, 33,
+                39, 38, 36, 36, 36, 36, 36, 36, 37, 37, 37, 37, 36, 36, 34, 33,
+            },
+            {
+                39, 38, 36, 36, 37, 37, 36, 36, 36, 36, 37, 37, 37, 37, 34, 33,
+                39, 38, 36, 36, 36, 36, 36, 36, 37, 37, 37, 37, 36, 36, 34, 33,
+            },
+            {
+                39, 38, 36, 36, 37, 37, 37, 37, 36, 36, 36, 36, 36, 36, 34, 33,
+                39, 38, 36, 36, 36, 36, 36, 36, 37, 37, 36, 36, 37, 37, 34, 33,
+            },
+            {
+                39, 38, 36, 36, 37, 37, 37, 37, 36, 36, 36, 36, 36, 36, 34, 33,
+                39, 38, 36, 36, 36, 36, 36, 36, 37, 37, 36, 36, 37, 37, 34, 33,
+            },
+            {
+                39, 38, 36, 36, 36, 36, 36, 36, 37, 37, 36, 36, 36, 36, 34, 33,
+                39, 38, 36, 36, 36, 36, 37, 37, 36, 36, 37, 37, 36, 36, 34, 33,
+            },
+            {
+                39, 38, 36, 36, 36, 36, 36, 36, 37, 37, 36, 36, 36, 36, 34, 33,
+                39, 38, 36, 36, 36, 36, 37, 37, 36, 36, 37, 37, 36, 36, 34, 33,
+            },
+            {
+                39, 38, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 33,
+                39, 38, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 33,
+            },
+            {
+                39, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+                39, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+            },
+            {
+                39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+                39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+            },
+            {
+                39, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 33,
+                39, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 33,
+            },
+            {
+                39, 38, 37, 37, 37, 37, 37, 37, 36, 36, 36, 36, 37, 37, 34, 33,
+                39, 38, 36, 36, 36, 36, 36, 36, 36, 36, 37, 37, 36, 36, 34, 33,
+            },
+            {
+                39, 38, 37, 37, 37, 37, 37, 37, 36, 36, 36, 36, 37, 37, 34, 33,
+                39, 38, 36, 36, 36, 36, 36, 36, 36, 36, 37, 37, 36, 36, 34, 33,
+            },
+            {
+                39, 38, 37, 37, 37, 37, 36, 36, 36, 36, 37, 37, 37, 37, 34, 33,
+                39, 38, 36, 36, 37, 37, 36, 36, 36, 36, 36, 36, 37, 37, 34, 33,
+            },
+            {
+                39, 38, 37, 37, 37, 37, 36, 36, 36, 36, 37, 37, 37, 37, 34, 33,
+                39, 38, 36, 36, 37, 37, 36, 36, 36, 36, 36, 36, 37, 37, 34, 33,
+            },
+            {
+                39, 38, 36, 36, 36, 36, 37, 37, 36, 36, 37, 37, 36, 36, 34, 33,
+                39, 38, 36, 36, 36, 36, 37, 37, 36, 36, 37, 37, 36, 36, 34, 33,
+            },
+            {
+                39, 38, 36, 36, 36, 36, 37, 37, 36, 36, 37, 37, 36, 36, 34, 33,
+                39, 38, 36, 36, 36, 36, 37, 37, 36, 36, 37, 37, 36, 36, 34, 33,
+            },
+            {
+                39, 38, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 34, 33,
+                39, 38, 36, 36, 36, 36, 37, 37, 37, 37, 36, 36, 37, 37, 34, 33,
+            },
+            {
+                39, 38, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 34, 33,
+                39, 38, 36, 36, 36, 36, 37, 37, 37, 37, 36, 36, 37, 37, 34, 33,
+            },
+            {
+                39, 38, 36, 36, 36, 36, 37, 37, 36, 36, 36, 36, 36, 36, 34, 33,
+                39, 38, 37, 37, 37, 37, 36, 36, 36, 36, 36, 36, 36, 36, 34, 33,
+            },
+            {
+                39, 38, 36, 36, 36, 36, 37, 37, 36, 36, 36, 36, 36, 36, 34, 33,
+                39, 38, 37, 37, 37, 37, 36, 36, 36, 36, 36, 36, 36, 36, 34, 33,
+            },
+            {
+                39, 38, 37, 37, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 34, 33,
+                39, 38, 36, 36, 36, 36, 36, 36, 37, 37, 36, 36, 37, 37, 34, 33,
+            },
+            {
+                39, 38, 37, 37, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 34, 33,
+                39, 38, 36, 36, 36, 36, 36, 36, 37, 37, 36, 36, 37, 37, 34, 33,
+            },
+            {
+                39, 38, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 33,
+                39, 38, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 33,
+            },
+            {
+                39, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+                39, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+            },
+        },
+        {
+            {
+                47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+                47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+            },
+            {
+                47, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 41,
+                47, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 41,
+            },
+            {
+                47, 46, 44, 44, 44, 44, 44, 44, 45, 45, 45, 45, 45, 45, 42, 41,
+                47, 46, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 42, 41,
+            },
+            {
+                47, 46, 44, 44, 44, 44, 44, 44, 45, 45, 45, 45, 45, 45, 42, 41,
+                47, 46, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 42, 41,
+            },
+            {
+                47, 46, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 42, 41,
+                47, 46, 45, 45, 45, 45, 45, 45, 44, 44, 45, 45, 44, 44, 42, 41,
+            },
+            {
+                47, 46, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 42, 41,
+                47, 46, 45, 45, 45, 45, 45, 45, 44, 44, 45, 45, 44, 44, 42, 41,
+            },
+            {
+                47, 46, 45, 45, 44, 44, 44, 44, 45, 45, 45, 45, 44, 44, 42, 41,
+                47, 46, 44, 44, 44, 44, 45, 45, 44, 44, 44, 44, 45, 45, 42, 41,
+            },
+            {
+                47, 46, 45, 45, 44, 44, 44, 44, 45, 45, 45, 45, 44, 44, 42, 41,
+                47, 46, 44, 44, 44, 44, 45, 45, 44, 44, 44, 44, 45, 45, 42, 41,
+            },
+            {
+                47, 46, 44, 44, 45, 45, 44, 44, 44, 44, 45, 45, 45, 45, 42, 41,
+                47, 46, 44, 44, 44, 44, 44, 44, 45, 45, 45, 45, 44, 44, 42, 41,
+            },
+            {
+                47, 46, 44, 44, 45, 45, 44, 44, 44, 44, 45, 45, 45, 45, 42, 41,
+                47, 46, 44, 44, 44, 44, 44, 44, 45, 45, 45, 45, 44, 44, 42, 41,
+            },
+            {
+                47, 46, 44, 44, 45, 45, 45, 45, 44, 44, 44, 44, 44, 44, 42, 41,
+                47, 46, 44, 44, 44, 44, 44, 44, 45, 45, 44, 44, 45, 45, 42, 41,
+            },
+            {
+                47, 46, 44, 44, 45, 45, 45, 45, 44, 44, 44, 44, 44, 44, 42, 41,
+                47, 46, 44, 44, 44, 44, 44, 44, 45, 45, 44, 44, 45, 45, 42, 41,
+            },
+            {
+                47, 46, 44, 44, 44, 44, 44, 44, 45, 45, 44, 44, 44, 44, 42, 41,
+                47, 46, 44, 44, 44, 44, 45, 45, 44, 44, 45, 45, 44, 44, 42, 41,
+            },
+            {
+                47, 46, 44, 44, 44, 44, 44, 44, 45, 45, 44, 44, 44, 44, 42, 41,
+                47, 46, 44, 44, 44, 44, 45, 45, 44, 44, 45, 45, 44, 44, 42, 41,
+            },
+            {
+                47, 46, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 41,
+                47, 46, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 41,
+            },
+            {
+                47, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+                47, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+            },
+            {
+                47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+                47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+            },
+            {
+                47, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 41,
+                47, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 41,
+            },
+            {
+                47, 46, 45, 45, 45, 45, 45, 45, 44, 44, 44, 44, 45, 45, 42, 41,
+                47, 46, 44, 44, 44, 44, 44, 44, 44, 44, 45, 45, 44, 44, 42, 41,
+            },
+            {
+                47, 46, 45, 45, 45, 45, 45, 45, 44, 44, 44, 44, 45, 45, 42, 41,
+                47, 46, 44, 44, 44, 44, 44, 44, 44, 44, 45, 45, 44, 44, 42, 41,
+            },
+            {
+                47, 46, 45, 45, 45, 45, 44, 44, 44, 44, 45, 45, 45, 45, 42, 41,
+                47, 46, 44, 44, 45, 45, 44, 44, 44, 44, 44, 44, 45, 45, 42, 41,
+            },
+            {
+                47, 46, 45, 45, 45, 45, 44, 44, 44, 44, 45, 45, 45, 45, 42, 41,
+                47, 46, 44, 44, 45, 45, 44, 44, 44, 44, 44, 44, 45, 45, 42, 41,
+            },
+            {
+                47, 46, 44, 44, 44, 44, 45, 45, 44, 44, 45, 45, 44, 44, 42, 41,
+                47, 46, 44, 44, 44, 44, 45, 45, 44, 44, 45, 45, 44, 44, 42, 41,
+            },
+            {
+                47, 46, 44, 44, 44, 44, 45, 45, 44, 44, 45, 45, 44, 44, 42, 41,
+                47, 46, 44, 44, 44, 44, 45, 45, 44, 44, 45, 45, 44, 44, 42, 41,
+            },
+            {
+                47, 46, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 42, 41,
+                47, 46, 44, 44, 44, 44, 45, 45, 45, 45, 44, 44, 45, 45, 42, 41,
+            },
+            {
+                47, 46, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 42, 41,
+                47, 46, 44, 44, 44, 44, 45, 45, 45, 45, 44, 44, 45, 45, 42, 41,
+            },
+            {
+                47, 46, 44, 44, 44, 44, 45, 45, 44, 44, 44, 44, 44, 44, 42, 41,
+                47, 46, 45, 45, 45, 45, 44, 44, 44, 44, 44, 44, 44, 44, 42, 41,
+            },
+            {
+                47, 46, 44, 44, 44, 44, 45, 45, 44, 44, 44, 44, 44, 44, 42, 41,
+                47, 46, 45, 45, 45, 45, 44, 44, 44, 44, 44, 44, 44, 44, 42, 41,
+            },
+            {
+                47, 46, 45, 45, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 42, 41,
+                47, 46, 44, 44, 44, 44, 44, 44, 45, 45, 44, 44, 45, 45, 42, 41,
+            },
+            {
+                47, 46, 45, 45, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 42, 41,
+                47, 46, 44, 44, 44, 44, 44, 44, 45, 45, 44, 44, 45, 45, 42, 41,
+            },
+            {
+                47, 46, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 41,
+                47, 46, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 41,
+            },
+            {
+                47, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+                47, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+            },
+        },
+    },
+    {
+        {
+            {
+                53, 51, 51, 50, 51, 51, 51, 52, 52, 53, 53, 54, 54, 52, 52, 52,
+                51, 51, 50, 51, 51, 51, 53, 53, 54, 54, 53, 52, 52, 51, 51, 51,
+            },
+            {
+                51, 51, 50, 51, 51, 52, 53, 53, 53, 53, 53, 53, 52, 51, 51, 51,
+                51, 51, 51, 52, 53, 53, 53, 53, 53, 53, 52, 51, 51, 50, 50, 51,
+            },
+            {
+                50, 51, 52, 52, 53, 53, 54, 54, 54, 53, 52, 52, 51, 51, 51, 51,
+                52, 51, 53, 53, 54, 53, 53, 53, 52, 51, 51, 51, 51, 50, 51, 52,
+            },
+            {
+                51, 52, 53, 53, 53, 54, 53, 52, 52, 52, 51, 51, 51, 50, 51, 52,
+                53, 53, 53, 54, 53, 53, 52, 52, 51, 51, 51, 51, 52, 52, 53, 53,
+            },
+            {
+                53, 53, 53, 54, 54, 52, 52, 51, 51, 51, 51, 51, 51, 52, 52, 53,
+                54, 54, 54, 53, 52, 51, 51, 51, 50, 51, 52, 52, 52, 53, 54, 53,
+            },
+            {
+                54, 54, 54, 53, 52, 52, 50, 51, 50, 51, 51, 52, 53, 53, 54, 53,
+                54, 53, 52, 52, 51, 50, 51, 51, 51, 52, 52, 53, 53, 53, 53, 53,
+            },
+            {
+                53, 53, 52, 51, 51, 51, 51, 51, 51, 52, 52, 53, 53, 54, 53, 53,
+                52, 51, 51, 51, 50, 51, 51, 52, 52, 54, 53, 54, 53, 53, 52, 52,
+            },
+            {
+                48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+                48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+            },
+            {
+                52, 53, 53, 53, 53, 54, 53, 53, 52, 52, 51, 51, 50, 51, 51, 52,
+                52, 53, 53, 54, 53, 53, 52, 51, 50, 50, 50, 51, 52, 53, 52, 54,
+            },
+            {
+                52, 53, 53, 53, 53, 52, 52, 52, 50, 51, 51, 51, 52, 52, 53, 53,
+                54, 53, 53, 52, 52, 51, 51, 50, 51, 51, 51, 52, 53, 53, 53, 54,
+            },
+            {
+                54, 53, 53, 53, 52, 51, 51, 50, 51, 51, 52, 52, 53, 54, 53, 54,
+                53, 52, 52, 52, 50, 51, 51, 51, 51, 52, 53, 54, 54, 53, 53, 52,
+            },
+            {
+                53, 52, 52, 52, 50, 50, 51, 51, 52, 53, 53, 53, 53, 54, 53, 53,
+                52, 51, 51, 50, 51, 51, 51, 52, 53, 54, 54, 53, 53, 52, 52, 51,
+            },
+            {
+                52, 51, 51, 51, 51, 51, 51, 53, 53, 54, 54, 54, 53, 53, 51, 51,
+                51, 51, 51, 51, 51, 53, 53, 53, 53, 53, 53, 53, 51, 51, 51, 50,
+            },
+            {
+                51, 50, 51, 51, 52, 52, 53, 54, 54, 53, 53, 52, 52, 51, 50, 51,
+                50, 51, 52, 53, 53, 54, 53, 54, 53, 52, 52, 51, 51, 51, 51, 51,
+            },
+            {
+                50, 51, 51, 52, 53, 53, 53, 54, 53, 53, 52, 51, 50, 50, 51, 51,
+                51, 52, 52, 53, 53, 54, 53, 52, 52, 51, 51, 50, 51, 51, 51, 52,
+            },
+            {
+                48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+                48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+            },
+            {
+                51, 51, 51, 50, 51, 51, 51, 53, 53, 53, 53, 54, 53, 52, 52, 51,
+                51, 50, 51, 51, 52, 52, 53, 54, 54, 54, 53, 52, 52, 51, 50, 51,
+            },
+            {
+                51, 50, 50, 51, 51, 53, 53, 54, 53, 53, 53, 52, 52, 51, 51, 51,
+                51, 51, 52, 53, 53, 53, 53, 53, 53, 52, 52, 51, 50, 51, 51, 51,
+            },
+            {
+                50, 51, 52, 52, 53, 54, 53, 54, 53, 52, 52, 51, 50, 50, 51, 52,
+                52, 53, 53, 53, 53, 54, 53, 52, 51, 51, 50, 51, 50, 51, 51, 52,
+            },
+            {
+                52, 52, 53, 53, 53, 53, 53, 53, 52, 51, 50, 50, 51, 51, 52, 52,
+                53, 54, 54, 53, 53, 52, 52, 51, 51, 51, 51, 51, 51, 53, 53, 54,
+            },
+            {
+                53, 53, 54, 54, 53, 53, 51, 51, 51, 51, 50, 51, 52, 52, 53, 53,
+                53, 53, 53, 52, 52, 51, 50, 50, 50, 51, 51, 53, 53, 53, 54, 54,
+            },
+            {
+                54, 53, 53, 52, 51, 51, 51, 51, 50, 51, 52, 52, 53, 54, 53, 53,
+                53, 52, 52, 51, 50, 50, 51, 51, 52, 52, 53, 53, 53, 54, 53, 52,
+            },
+            {
+                53, 52, 51, 51, 50, 50, 51, 52, 52, 53, 53, 53, 53, 54, 53, 52,
+                52, 51, 51, 50, 51, 52, 52, 52, 53, 54, 54, 53, 52, 52, 51, 51,
+            },
+            {
+                48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+                48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+            },
+            {
+                52, 53, 53, 54, 53, 53, 53, 52, 51, 51, 51, 51, 51, 52, 52, 53,
+                53, 53, 53, 53, 52, 52, 52, 50, 51, 51, 51, 51, 52, 53, 53, 53,
+            },
+            {
+                54, 54, 53, 53, 52, 52, 51, 50, 50, 51, 51, 52, 53, 53, 54, 53,
+                53, 53, 53, 52, 51, 51, 51, 51, 51, 52, 52, 53, 53, 53, 53, 53,
+            },
+            {
+                53, 53, 52, 52, 51, 51, 51, 51, 51, 52, 52, 53, 54, 54, 53, 53,
+                52, 51, 51, 50, 51, 51, 51, 52, 52, 53, 54, 53, 53, 53, 52, 51,
+            },
+            {
+                52, 52, 51, 51, 50, 50, 51, 52, 52, 53, 53, 53, 53, 53, 52, 52,
+                51, 51, 51, 51, 51, 51, 52, 53, 53, 54, 53, 53, 52, 52, 51, 51,
+            },
+            {
+                52, 50, 51, 50, 51, 52, 52, 53, 53, 53, 53, 53, 53, 52, 51, 50,
+                50, 51, 51, 51, 53, 52, 53, 53, 53, 53, 53, 52, 52, 50, 50, 51,
+            },
+            {
+                50, 51, 51, 52, 52, 53, 54, 54, 53, 53, 52, 52, 51, 50, 50, 50,
+                51, 51, 52, 53, 54, 54, 54, 53, 52, 51, 51, 50, 50, 50, 51, 51,
+            },
+            {
+                51, 52, 52, 53, 53, 53, 53, 53, 53, 52, 51, 50, 51, 51, 51, 52,
+                53, 53, 53, 53, 54, 53, 52, 52, 51, 50, 51, 51, 51, 51, 53, 53,
+            },
+            {
+                48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+                48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+            },
+        },
+        {
+            {
+                61, 59, 59, 58, 59, 59, 59, 60, 60, 61, 61, 62, 62, 60, 60, 60,
+                59, 59, 58, 59, 59, 59, 61, 61, 62, 62, 61, 60, 60, 59, 59, 59,
+            },
+            {
+                59, 59, 58, 59, 59, 60, 61, 61, 61, 61, 61, 61, 60, 59, 59, 59,
+                59, 59, 59, 60, 61, 61, 61, 61, 61, 61, 60, 59, 59, 58, 58, 59,
+            },
+            {
+                58, 59, 60, 60, 61, 61, 62, 62, 62, 61, 60, 60, 59, 59, 59, 59,
+                60, 59, 61, 61, 62, 61, 61, 61, 60, 59, 59, 59, 59, 58, 59, 60,
+            },
+            {
+                59, 60, 61, 61, 61, 62, 61, 60, 60, 60, 59, 59, 59, 58, 59, 60,
+                61, 61, 61, 62, 61, 61, 60, 60, 59, 59, 59, 59, 60, 60, 61, 61,
+            },
+            {
+                61, 61, 61, 62, 62, 60, 60, 59, 59, 59, 59, 59, 59, 60, 60, 61,
+                62, 62, 62, 61, 60, 59, 59, 59, 58, 59, 60, 60, 60, 61, 62, 61,
+            },
+            {
+                62, 62, 62, 61, 60, 60, 58, 59, 58, 59, 59, 60, 61, 61, 62, 61,
+                62, 61, 60, 60, 59, 58, 59, 59, 59, 60, 60, 61, 61, 61, 61, 61,
+            },
+            {
+                61, 61, 60, 59, 59, 59, 59, 59, 59, 60, 60, 61, 61, 62, 61, 61,
+                60, 59, 59, 59, 58, 59, 59, 60, 60, 62, 61, 62, 61, 61, 60, 60,
+            },
+            {
+                56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+                56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+            },
+            {
+                60, 61, 61, 61, 61, 62, 61, 61, 60, 60, 59, 59, 58, 59, 59, 60,
+                60, 61, 61, 62, 61, 61, 60, 59, 58, 58, 58, 59, 60, 61, 60, 62,
+            },
+            {
+                60, 61, 61, 61, 61, 60, 60, 60, 58, 59, 59, 59, 60, 60, 61, 61,
+                62, 61, 61, 60, 60, 59, 59, 58, 59, 59, 59, 60, 61, 61, 61, 62,
+            },
+            {
+                62, 61, 61, 61, 60, 59, 59, 58, 59, 59, 60, 60, 61, 62, 61, 62,
+                61, 60, 60, 60, 58, 59, 59, 59, 59, 60, 61, 62, 62, 61, 61, 60,
+            },
+            {
+                61, 60, 60, 60, 58, 58, 59, 59, 60, 61, 61, 61, 61, 62, 61, 61,
+                60, 59, 59, 58, 59, 59, 59, 60, 61, 62, 62, 61, 61, 60, 60, 59,
+            },
+            {
+                60, 59, 59, 59, 59, 59, 59, 61, 61, 62, 62, 62, 61, 61, 59, 59,
+                59, 59, 59, 59, 59, 61, 61, 61, 61, 61, 61, 61, 59, 59, 59, 58,
+            },
+            {
+                59, 58, 59, 59, 60, 60, 61, 62, 62, 61, 61, 60, 60, 59, 58, 59,
+                58, 59, 60, 61, 61, 62, 61, 62, 61, 60, 60, 59, 59, 59, 59, 59,
+            },
+            {
+                58, 59, 59, 60, 61, 61, 61, 62, 61, 61, 60, 59, 58, 58, 59, 59,
+                59, 60, 60, 61, 61, 62, 61, 60, 60, 59, 59, 58, 59, 59, 59, 60,
+            },
+            {
+                56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+                56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+            },
+            {
+                59, 59, 59, 58, 59, 59, 59, 61, 61, 61, 61, 62, 61, 60, 60, 59,
+                59, 58, 59, 59, 60, 60, 61, 62, 62, 62, 61, 60, 60, 59, 58, 59,
+            },
+            {
+                59, 58, 58, 59, 59, 61, 61, 62, 61, 61, 61, 60, 60, 59, 59, 59,
+                59, 59, 60, 61, 61, 61, 61, 61, 61, 60, 60, 59, 58, 59, 59, 59,
+            },
+            {
+                58, 59, 60, 60, 61, 62, 61, 62, 61, 60, 60, 59, 58, 58, 59, 60,
+                60, 61, 61, 61, 61, 62, 61, 60, 59, 59, 58, 59, 58, 59, 59, 60,
+            },
+            {
+                60, 60, 61, 61, 61, 61, 61, 61, 60, 59, 58, 58, 59, 59, 60, 60,
+                61, 62, 62, 61, 61, 60, 60, 59, 59, 59, 59, 59, 59, 61, 61, 62,
+            },
+            {
+                61, 61, 62, 62, 61, 61, 59, 59, 59, 59, 58, 59, 60, 60, 61, 61,
+                61, 61, 61, 60, 60, 59, 58, 58, 58, 59, 59, 61, 61, 61, 62, 62,
+            },
+            {
+                62, 61, 61, 60, 59, 59, 59, 59, 58, 59, 60, 60, 61, 62, 61, 61,
+                61, 60, 60, 59, 58, 58, 59, 59, 60, 60, 61, 61, 61, 62, 61, 60,
+            },
+            {
+                61, 60, 59, 59, 58, 58, 59, 60, 60, 61, 61, 61, 61, 62, 61, 60,
+                60, 59, 59, 58, 59, 60, 60, 60, 61, 62, 62, 61, 60, 60, 59, 59,
+            },
+            {
+                56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+                56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+            },
+            {
+                60, 61, 61, 62, 61, 61, 61, 60, 59, 59, 59, 59, 59, 60, 60, 61,
+                61, 61, 61, 61, 60, 60, 60, 58, 59, 59, 59, 59, 60, 61, 61, 61,
+            },
+            {
+                62, 62, 61, 61, 60, 60, 59, 58, 58, 59, 59, 60, 61, 61, 62, 61,
+                61, 61, 61, 60, 59, 59, 59, 59, 59, 60, 60, 61, 61, 61, 61, 61,
+            },
+            {
+                61, 61, 60, 60, 59, 59, 59, 59, 59, 60, 60, 61, 62, 62, 61, 61,
+                60, 59, 59, 58, 59, 59, 59, 60, 60, 61, 62, 61, 61, 61, 60, 59,
+            },
+            {
+                60, 60, 59, 59, 58, 58, 59, 60, 60, 61, 61, 61, 61, 61, 60, 60,
+                59, 59, 59, 59, 59, 59, 60, 61, 61, 62, 61, 61, 60, 60, 59, 59,
+            },
+            {
+                60, 58, 59, 58, 59, 60, 60, 61, 61, 61, 61, 61, 61, 60, 59, 58,
+                58, 59, 59, 59, 61, 60, 61, 61, 61, 61, 61, 60, 60, 58, 58, 59,
+            },
+            {
+                58, 59, 59, 60, 60, 61, 62, 62, 61, 61, 60, 60, 59, 58, 58, 58,
+                59, 59, 60, 61, 62, 62, 62, 61, 60, 59, 59, 58, 58, 58, 59, 59,
+            },
+            {
+                59, 60, 60, 61, 61, 61, 61, 61, 61, 60, 59, 58, 59, 59, 59, 60,
+                61, 61, 61, 61, 62, 61, 60, 60, 59, 58, 59, 59, 59, 59, 61, 61,
+            },
+            {
+                56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+                56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+            },
+        },
+    },
+};
+
+const u16 spritePalette[SPRITE_PALETTE_SIZE] = {
+    0x0486, 0x04A9, 0x08EB, 0x090E, 0x0D50, 0x0D73, 0x11B5, 0x11D8,
+    0x04E8, 0x054B, 0x09AE, 0x0A12, 0x0E75, 0x0ED8, 0x133C, 0x139F,
+};
+
+const u8 spriteTextures[SPRITE_TEXTURE_COUNT][TEX_SIZE][TEX_SIZE] = {
+    {
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 67, 67, 68, 67, 64, 64,
+            67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 64, 64, 67, 67, 67, 67,
+        },
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 68, 69, 68, 68, 65, 66,
+            68, 68, 69, 68, 68, 68, 68, 68, 68, 69, 65, 65, 69, 69, 68, 69,
+        },
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 69, 69, 69, 70, 67, 67,
+            69, 69, 69, 69, 70, 70, 69, 69, 70, 70, 66, 67, 70, 69, 69, 70,
+        },
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 69, 70, 70, 70, 67, 67,
+            70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 67, 67, 70, 70, 70, 70,
+        },
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 70, 70, 70, 70, 67, 67,
+            70, 70, 70, 71, 70, 70, 71, 71, 71, 71, 67, 68, 71, 71, 70, 71,
+        },
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 70, 70, 71, 71, 67, 68,
+            71, 70, 71, 71, 71, 71, 71, 71, 71, 71, 68, 68, 70, 70, 70, 70,
+        },
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 71, 71, 71, 71, 68, 68,
+            71, 71, 71, 71, 71, 71, 71, 71, 70, 71, 68, 68, 71, 71, 71, 71,
+        },
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 71, 71, 71, 71, 68, 68,
+            71, 71, 71, 71, 71, 71, 71, 71, 71, 70, 68, 68, 71, 71, 71, 71,
+        },
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 71, 71, 71, 71, 68, 68,
+            71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 68, 68, 71, 71, 71, 71,
+        },
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 71, 71, 71, 71, 67, 67,
+            70, 71, 71, 71, 71, 71, 71, 71, 71, 71, 68, 68, 71, 71, 71, 71,
+        },
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 71, 70, 71, 70, 68, 68,
+            70, 70, 71, 70, 71, 71, 71, 70, 70, 70, 67, 68, 71, 71, 71, 71,
+        },
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 71, 71, 70, 71, 67, 68,
+            71, 71, 71, 71, 71, 70, 71, 71, 71, 70, 68, 68, 71, 71, 70, 70,
+        },
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 70, 70, 70, 70, 67, 67,
+            70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 67, 67, 70, 70, 70, 70,
+        },
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 69, 69, 69, 69, 66, 67,
+            70, 69, 70, 69, 70, 69, 70, 69, 69, 69, 66, 66, 69, 69, 69, 70,
+        },
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 69, 69, 69, 69, 66, 65,
+            68, 69, 68, 68, 69, 68, 68, 69, 69, 69, 65, 66, 68, 68, 68, 68,
+        },
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 67, 67, 67, 67, 64, 64,
+            67, 67, 67, 67, 67, 67, 68, 67, 67, 67, 64, 64, 67, 67, 67, 68,
+        },
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+    },
+    {
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 78, 78, 77, 76, 0, 0, 0, 0,
+        },
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 79, 79, 78, 77, 76, 75, 0, 0, 0,
+        },
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 78, 79, 79, 78, 77, 76, 75, 72, 0, 0,
+        },
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 78, 78, 78, 77, 76, 75, 74, 72, 0, 0,
+        },
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 77, 77, 77, 76, 76, 74, 73, 72, 0, 0,
+        },
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 76, 76, 76, 75, 74, 73, 72, 72, 0, 0,
+        },
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 75, 75, 74, 73, 72, 72, 0, 0, 0,
+        },
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 72, 72, 72, 72, 0, 0, 0, 0,
+        },
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+    },
+};
@@ -0,0 +1,21 @@
+// Generated by common/tools/mapconv.c from maps/world.txt, do not edit
+#include "map_stream.h"
+
+static const u32 worldMapOffsets[1] = {
+    0,
+};
+
+static const u8 worldMapData[81] = {
+    // Chunk (0, 0), RLE
+    0x01, 0x08, 0x01, 0x06, 0x00, 0x00, 0x01, 0x06, 0x00, 0x00, 0x01, 0x06,
+    0x00, 0x00, 0x01, 0x01, 0x00, 0x02, 0x02, 0x01, 0x00, 0x00, 0x01, 0x06,
+    0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00, 0x03, 0x00,
+    0x01, 0x06, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00,
+    0x03, 0x00, 0x01, 0x06, 0x00, 0x00, 0x01, 0x03, 0x00, 0x00, 0x03, 0x01,
+    0x00, 0x00, 0x01, 0x06, 0x00, 0x00, 0x01, 0x03, 0x00, 0x00, 0x03, 0x01,
+    0x00, 0x00, 0x01, 0x06, 0x00, 0x08, 0x01, 0x86, 0x00,
+};
+
+const ChunkedMap worldMap = {
+    9, 8, 1, 1, worldMapOffsets, worldMapData
+};
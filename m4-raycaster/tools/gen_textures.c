@@ -0,0 +1,213 @@
+/*
+ * Generates source/textures.c, the raycaster's wall and sprite textures.
+ * This is a host tool, build and run it with:
+ *     cc -o gen_textures tools/gen_textures.c -lm
+ *     ./gen_textures > source/textures.c
+ *
+ * Every texture is TEX_SIZE x TEX_SIZE 8-bit pixels drawn from its own
+ * 16-entry slice of the palette: 8 light shades for walls hit on an
+ * east/west face and the same 8 shades darkened for north/south faces.
+ * Sprites have one set of 8 shades each, and use index 0 where they are
+ * transparent.
+ */
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+
+enum GeneratorConsts {
+    TEX_SIZE = 32,
+    TEXTURE_COUNT = 3,
+    SHADES = 8,
+    PALETTE_START = 16,
+    SIDES = 2,
+    SPRITE_COUNT = 2,
+    SPRITE_PALETTE_START = PALETTE_START + TEXTURE_COUNT * SIDES * SHADES,
+    TRANSPARENT = 0,
+};
+
+typedef struct Rgb {
+    double r, g, b;
+} Rgb;
+
+// Brightest shade of every texture, in 5-bit GBA color components
+static const Rgb baseColors[TEXTURE_COUNT] = {
+    { 22, 6, 31 },  // Purple brick
+    { 20, 22, 26 }, // Grey stone
+    { 28, 16, 6 },  // Wooden planks
+};
+
+// Walls seen side on are drawn with a darker copy of the palette
+static const double DARK_SIDE = 0.55;
+
+// Small deterministic noise in [0, 1)
+static double noise(int x, int y, int seed) {
+    uint32_t h = x * 374761393u + y * 668265263u + seed * 2246822519u;
+    h = (h ^ (h >> 13)) * 1274126177u;
+    return ((h ^ (h >> 16)) & 0xFFFF) / 65536.0;
+}
+
+static int clamp_shade(double shade) {
+    int s = (int)(shade + 0.5);
+    return s < 0 ? 0 : s >= SHADES ? SHADES - 1 : s;
+}
+
+// Bricks 8 rows high and 16 columns wide, every other row offset by half
+static int brick(int x, int y) {
+    int row = y / 8;
+    int bx = (x + (row & 1) * 8) % 16;
+    int by = y % 8;
+    if (by == 7 || bx == 15) {
+        return 1;
+    }
+    double shade = 4.5 + 1.5 * noise(row, (x + (row & 1) * 8) / 16, 1)
+        + noise(x, y, 2) - 0.5;
+    if (by == 0) {
+        shade += 1;
+    }
+    return clamp_shade(shade);
+}
+
+// Bevelled 16x16 blocks
+static int stone(int x, int y) {
+    int bx = x % 16;
+    int by = y % 16;
+    if (bx == 0 || by == 0) {
+        return 7;
+    }
+    if (bx == 15 || by == 15) {
+        return 1;
+    }
+    if (bx == 1 || by == 1) {
+        return 6;
+    }
+    if (bx == 14 || by == 14) {
+        return 2;
+    }
+    return clamp_shade(4 + 1.5 * noise(x / 2, y / 2, 3) - 0.5);
+}
+
+// Vertical planks 8 columns wide with a wavy grain
+static int wood(int x, int y) {
+    int plank = x / 8;
+    int px = x % 8;
+    if (px == 7) {
+        return 0;
+    }
+    double grain = sin((y + 7 * plank) * 0.45 + px * 0.9 + noise(plank, 0, 4) * 6);
+    return clamp_shade(4 + 1.5 * grain + noise(x, y, 5) - 0.5);
+}
+
+static int (*const patterns[TEXTURE_COUNT])(int x, int y) = {
+    brick,
+    stone,
+    wood,
+};
+
+// Brightest shade of every sprite
+static const Rgb spriteColors[SPRITE_COUNT] = {
+    { 24, 14, 4 },  // Barrel
+    { 31, 28, 4 },  // Gold orb
+};
+
+// A barrel standing on the floor, shaded as a cylinder with two hoops
+static int barrel(int x, int y) {
+    if (x < 8 || x > 23 || y < 10) {
+        return TRANSPARENT;
+    }
+    double across = (x - 15.5) / 8;
+    double shade = 1 + 6 * sqrt(1 - across * across) + noise(x, y, 6) - 0.5;
+    if (y == 14 || y == 15 || y == 26 || y == 27) {
+        shade -= 3;
+    }
+    return SPRITE_PALETTE_START + clamp_shade(shade);
+}
+
+// A small sphere floating just above the floor, lit from the top left
+static int orb(int x, int y) {
+    double dx = (x - 15.5) / 4;
+    double dy = (y - 25.5) / 4;
+    double r2 = dx * dx + dy * dy;
+    if (r2 > 1) {
+        return TRANSPARENT;
+    }
+    double light = (-dx - dy + sqrt(1 - r2)) / sqrt(3);
+    return SPRITE_PALETTE_START + SHADES + clamp_shade(1 + 6 * light);
+}
+
+static int (*const spritePatterns[SPRITE_COUNT])(int x, int y) = {
+    barrel,
+    orb,
+};
+
+static unsigned to_color(Rgb rgb) {
+    unsigned r = (unsigned)(rgb.r + 0.5);
+    unsigned g = (unsigned)(rgb.g + 0.5);
+    unsigned b = (unsigned)(rgb.b + 0.5);
+    return r | (g << 5) | (b << 10);
+}
+
+// Print the 8 shades of base, ramping from a quarter to full brightness
+static void print_shades(Rgb base, double scale) {
+    printf("   ");
+    for (int s = 0; s < SHADES; s++) {
+        double shade = (0.25 + 0.75 * s / (SHADES - 1)) * scale;
+        Rgb c = { base.r * shade, base.g * shade, base.b * shade };
+        printf(" 0x%04X,", to_color(c));
+    }
+    printf("\n");
+}
+
+// Print one texture column by column
+static void print_texture(const char *indent, int base,
+    int (*pattern)(int x, int y))
+{
+    printf("%s{\n", indent);
+    for (int x = 0; x < TEX_SIZE; x++) {
+        printf("%s    {", indent);
+        for (int y = 0; y < TEX_SIZE; y++) {
+            if (y % 16 == 0) {
+                printf("\n%s       ", indent);
+            }
+            printf(" %d,", base + pattern(x, y));
+        }
+        printf("\n%s    },\n", indent);
+    }
+    printf("%s},\n", indent);
+}
+
+int main(void) {
+    printf("// Generated by tools/gen_textures.c, do not edit\n");
+    printf("#include \"textures.h\"\n\n");
+
+    printf("const u16 wallPalette[WALL_PALETTE_SIZE] = {\n");
+    for (int t = 0; t < TEXTURE_COUNT; t++) {
+        for (int side = 0; side < SIDES; side++) {
+            print_shades(baseColors[t], side ? DARK_SIDE : 1.0);
+        }
+    }
+    printf("};\n\n");
+
+    printf("const u8 wallTextures[WALL_TEXTURE_COUNT][RAY_SIDES][TEX_SIZE][TEX_SIZE] = {\n");
+    for (int t = 0; t < TEXTURE_COUNT; t++) {
+        printf("    {\n");
+        for (int side = 0; side < SIDES; side++) {
+            int base = PALETTE_START + t * 2 * SHADES + side * SHADES;
+            print_texture("        ", base, patterns[t]);
+        }
+        printf("    },\n");
+    }
+    printf("};\n\n");
+
+    printf("const u16 spritePalette[SPRITE_PALETTE_SIZE] = {\n");
+    for (int t = 0; t < SPRITE_COUNT; t++) {
+        print_shades(spriteColors[t], 1.0);
+    }
+    printf("};\n\n");
+
+    printf("const u8 spriteTextures[SPRITE_TEXTURE_COUNT][TEX_SIZE][TEX_SIZE] = {\n");
+    for (int t = 0; t < SPRITE_COUNT; t++) {
+        print_texture("    ", 0, spritePatterns[t]);
+    }
+    printf("};\n");
+    return 0;
+}
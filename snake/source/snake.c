@@ -1,14 +1,37 @@
 #include "tonc_video.h"
 #include <tonc.h>
-#include <stdlib.h>  // Required for rand()
-#include <time.h>    // Required for seeding rand()
+
+// Seed of the food placement. The same seed always plays out the same way
+#ifndef SNAKE_SEED
+#define SNAKE_SEED 0x2545F491
+#endif
+
+// Build with TILED set to 1 to draw on a mode 0 tiled background instead
+// of the mode 3 bitmap
+#ifndef TILED
+#define TILED 0
+#endif
 
 #define SCREEN_WIDTH  240
 #define SCREEN_HEIGHT 160
 #define TILE_SIZE      8
-#define MAX_LENGTH    100
+#define GRID_WIDTH    (SCREEN_WIDTH / TILE_SIZE)
+#define GRID_HEIGHT   (SCREEN_HEIGHT / TILE_SIZE)
+#define MAX_LENGTH    (GRID_WIDTH * GRID_HEIGHT)  // The whole board
+#define START_LENGTH  5
 #define MOVE_DELAY    5  // Number of frames before moving
 
+#define FLOOR_COLOR   RGB15(0, 0, 0)
+#define SNAKE_COLOR   RGB15(31, 31, 31)
+#define FOOD_COLOR    RGB15(31, 0, 0)
+
+// What a cell holds, also its tile in the tiled build
+#define FLOOR_TILE    0
+#define SNAKE_TILE    1
+#define FOOD_TILE     2
+#define TILE_COUNT    3
+#define BOARD_SBB     31  // Screenblock of the tiled board, clear of the tiles
+
 // Directions
 #define UP    0
 #define DOWN  1
@@ -19,78 +42,195 @@ typedef struct {
     int x, y;
 } Point;
 
+// Ring buffer of segments, the head at snake[snake_head] and the tail
+// snake_length - 1 slots before it. Moving writes one slot and drops one
 Point snake[MAX_LENGTH];
-int snake_length = 5;
+int snake_head = 0;
+int snake_length = 0;
+// Segments still to grow, the tail stays put while there are any
+int snake_growth = START_LENGTH - 1;
+// Bit x of row y is set where a segment covers cell (x, y)
+u32 occupied[GRID_HEIGHT];
+// Cells no segment covers, y * GRID_WIDTH + x, in free_cells[0, free_count).
+// free_slot gives each free cell's place in free_cells, so a cell is added
+// or removed in O(1) by swapping with the last one
+u16 free_cells[MAX_LENGTH];
+u16 free_slot[MAX_LENGTH];
+int free_count = 0;
+u32 rng_state = SNAKE_SEED;
 int direction = RIGHT;
 Point food;
 int frame_counter = 0;  // For delaying movement
 
-void spawn_food() {
-    do {
-        food.x = (rand() % (SCREEN_WIDTH / TILE_SIZE)) * TILE_SIZE;
-        food.y = (rand() % (SCREEN_HEIGHT / TILE_SIZE)) * TILE_SIZE;
-
-        // Ensure food is not placed on the snake
-        int valid = 1;
-        for (int i = 0; i < snake_length; i++) {
-            if (snake[i].x == food.x && snake[i].y == food.y) {
-                valid = 0;
-                break;
-            }
-        }
-        if (valid) break;  // Exit loop if food is placed correctly
+const COLOR tile_colors[TILE_COUNT] = { FLOOR_COLOR, SNAKE_COLOR, FOOD_COLOR };
+
+// xorshift32, never 0 for a seed other than 0
+static inline u32 next_random() {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+static inline int cell_index(Point p) {
+    return (p.y / TILE_SIZE) * GRID_WIDTH + p.x / TILE_SIZE;
+}
+
+static inline void add_free(int cell) {
+    free_cells[free_count] = cell;
+    free_slot[cell] = free_count++;
+}
+
+static inline void remove_free(int cell) {
+    int last = free_cells[--free_count];
+    free_cells[free_slot[cell]] = last;
+    free_slot[last] = free_slot[cell];
+}
+
+// Paint one whole cell. Only cells that change are drawn, never the
+// whole screen, so a move costs the same few hundred bytes of VRAM, or
+// one screen entry when tiled
+static inline void draw_cell(Point p, int tile) {
+#if TILED
+    se_mem[BOARD_SBB][(p.y / TILE_SIZE) * 32 + p.x / TILE_SIZE] = tile;
+#else
+    m3_rect(p.x, p.y, p.x + TILE_SIZE, p.y + TILE_SIZE, tile_colors[tile]);
+#endif
+}
+
+void clear_board() {
+#if TILED
+    memset16(se_mem[BOARD_SBB], FLOOR_TILE, 32 * 32);
+#else
+    m3_fill(FLOOR_COLOR);
+#endif
+}
+
+// Mode 3, or mode 0 with solid 4bpp tiles, tile n in palette color n + 1
+void init_video() {
+#if TILED
+    for (int tile = 0; tile < TILE_COUNT; tile++) {
+        pal_bg_mem[tile + 1] = tile_colors[tile];
+        memset32(&tile_mem[0][tile], 0x11111111 * (tile + 1), 8);
+    }
+    pal_bg_mem[0] = FLOOR_COLOR;
+    REG_BG0CNT = BG_CBB(0) | BG_SBB(BOARD_SBB) | BG_4BPP | BG_REG_32x32;
+    REG_DISPCNT = DCNT_MODE0 | DCNT_BG0;
+#else
+    REG_DISPCNT = DCNT_MODE3 | DCNT_BG2;
+#endif
+}
+
+static inline u32 cell_bit(Point p) {
+    return 1u << (p.x / TILE_SIZE);
+}
+
+static inline int is_occupied(Point p) {
+    return (occupied[p.y / TILE_SIZE] & cell_bit(p)) != 0;
+}
+
+// Slot of segment i, counting back from the head
+static inline int segment_slot(int i) {
+    int slot = snake_head - i;
+    return slot < 0 ? slot + MAX_LENGTH : slot;
+}
 
-    } while (1);
+void push_head(Point p) {
+    snake_head = snake_head + 1 == MAX_LENGTH ? 0 : snake_head + 1;
+    snake[snake_head] = p;
+    snake_length++;
+    occupied[p.y / TILE_SIZE] |= cell_bit(p);
+    remove_free(cell_index(p));
+    draw_cell(p, SNAKE_TILE);
+}
+
+void drop_tail() {
+    Point tail = snake[segment_slot(snake_length - 1)];
+    snake_length--;
+    occupied[tail.y / TILE_SIZE] &= ~cell_bit(tail);
+    add_free(cell_index(tail));
+    draw_cell(tail, FLOOR_TILE);
+}
+
+// A single cell snake at the top left, with every other cell free. The
+// only time the whole screen is drawn
+void start_snake() {
+    clear_board();
+    snake_length = 0;
+    snake_growth = START_LENGTH - 1;
+    free_count = 0;
+    for (int y = 0; y < GRID_HEIGHT; y++) {
+        occupied[y] = 0;
+    }
+    for (int cell = 0; cell < MAX_LENGTH; cell++) {
+        add_free(cell);
+    }
+    Point start = { 0, 0 };
+    push_head(start);  // The rest of the snake grows out behind it
+}
+
+// Any free cell, all equally likely, in constant time
+void spawn_food() {
+    if (!free_count) {
+        // The snake covers the board. That is a win, play again
+        start_snake();
+    }
+    // Eaten food is under the head already, otherwise clear it away
+    if (!is_occupied(food)) {
+        draw_cell(food, FLOOR_TILE);
+    }
+    int cell = free_cells[((u64)next_random() * free_count) >> 32];
+    food.x = (cell % GRID_WIDTH) * TILE_SIZE;
+    food.y = (cell / GRID_WIDTH) * TILE_SIZE;
+    draw_cell(food, FOOD_TILE);
 }
 
 void update_snake() {
     if (frame_counter++ < MOVE_DELAY) return; // Slow down movement
     frame_counter = 0; // Reset counter
 
-    for (int i = snake_length - 1; i > 0; i--) {
-        snake[i] = snake[i - 1];
-    }
-
     // Move head
+    Point next = snake[snake_head];
     switch (direction) {
-        case UP:    snake[0].y -= TILE_SIZE; break;
-        case DOWN:  snake[0].y += TILE_SIZE; break;
-        case LEFT:  snake[0].x -= TILE_SIZE; break;
-        case RIGHT: snake[0].x += TILE_SIZE; break;
+        case UP:    next.y -= TILE_SIZE; break;
+        case DOWN:  next.y += TILE_SIZE; break;
+        case LEFT:  next.x -= TILE_SIZE; break;
+        case RIGHT: next.x += TILE_SIZE; break;
     }
 
     // Wrap around screen
-    if (snake[0].x < 0) snake[0].x = SCREEN_WIDTH - TILE_SIZE;
-    if (snake[0].x >= SCREEN_WIDTH) snake[0].x = 0;
-    if (snake[0].y < 0) snake[0].y = SCREEN_HEIGHT - TILE_SIZE;
-    if (snake[0].y >= SCREEN_HEIGHT) snake[0].y = 0;
+    if (next.x < 0) next.x = SCREEN_WIDTH - TILE_SIZE;
+    if (next.x >= SCREEN_WIDTH) next.x = 0;
+    if (next.y < 0) next.y = SCREEN_HEIGHT - TILE_SIZE;
+    if (next.y >= SCREEN_HEIGHT) next.y = 0;
 
-    // Check collision with food
-    if (snake[0].x == food.x && snake[0].y == food.y) {
-        if (snake_length < MAX_LENGTH) snake_length++;
-        spawn_food();
+    // The tail moves out of the way first, unless the snake is growing
+    if (snake_growth) {
+        snake_growth--;
+    } else {
+        drop_tail();
     }
 
-    // Check self-collision
-    for (int i = 1; i < snake_length; i++) {
-        if (snake[0].x == snake[i].x && snake[0].y == snake[i].y) {
-            snake_length = 5; // Reset snake
-            spawn_food();
-            break;
+    // Check self-collision. The snake is cut back to START_LENGTH, and
+    // further if the cell it bit is among what is left
+    int bitten = is_occupied(next);
+    if (bitten) {
+        snake_growth = 0;
+        while (snake_length > START_LENGTH - 1 || is_occupied(next)) {
+            drop_tail();
         }
     }
-}
+    push_head(next);
 
-void draw_snake() {
-    for (int i = 0; i < snake_length; i++) {
-        m3_plot(snake[i].x, snake[i].y, RGB15(31, 31, 31));
+    // Check collision with food
+    if (next.x == food.x && next.y == food.y) {
+        if (snake_length + snake_growth < MAX_LENGTH) snake_growth++;
+        spawn_food();
+    } else if (bitten) {
+        spawn_food();
     }
 }
 
-void draw_food() {
-    m3_plot(food.x, food.y, RGB15(31, 0, 0));
-}
-
 void handle_input() {
     if (key_hit(KEY_UP) && direction != DOWN) direction = UP;
     if (key_hit(KEY_DOWN) && direction != UP) direction = DOWN;
@@ -99,19 +239,18 @@ void handle_input() {
 }
 
 int main() {
-    REG_DISPCNT = DCNT_MODE3 | DCNT_BG2;
-    
-    srand(time(NULL));  // Properly seed random number generator
+    init_video();
+    start_snake();
     spawn_food();
 
+    // Sleep in the BIOS until VBlank instead of polling REG_VCOUNT
+    irq_init(NULL);
+    irq_add(II_VBLANK, NULL);
     while (1) {
-        vid_vsync();
+        VBlankIntrWait();
         key_poll();
-        m3_fill(RGB15(0, 0, 0)); // Clear screen
         handle_input();
-        update_snake();
-        draw_snake();
-        draw_food();
+        update_snake();  // Draws the cells it changes
     }
 }
 